@@ -1,17 +1,123 @@
 #include <Arduino.h>
 #include <Wire.h>
+#include <util/crc16.h>
 
 #define SPA_ADDRESS 0x17
 #define SERIAL_BAUD 115200
 
-// I2C receive buffer
-volatile uint8_t i2cBuffer[128];
-volatile uint8_t i2cBufferLen = 0;
-volatile bool newI2CMessage = false;
+// Binary link (V2) framing: 0x00 <COBS(type, len_lo, len_hi, payload, crc8)> 0x00
+// crc8 is CRC-8/SMBUS (poly 0x07, init 0x00) over type, length and payload.
+// Text lines (V1 protocol) may still be interleaved between frames.
+#define LINK_DELIMITER 0x00
+#define LINK_FRAME_RX 'R'       // I2C message received from spa (proxy -> ESP)
+#define LINK_FRAME_TX 'T'       // I2C message to send to spa (ESP -> proxy)
+#define LINK_FRAME_MSG 'M'      // Reassembled multi-part payload (proxy -> ESP)
+#define LINK_FRAME_CAPTURE 'C'  // Timestamped bus event (proxy -> ESP, CAPTURE mode)
+#define LINK_FRAME_OVERHEAD 4   // type + 2 length bytes + crc
 
-// UART receive buffer
-char uartBuffer[512];
-uint16_t uartBufferPos = 0;
+// Buffers are sized from the protocol (SPA_MAX_FRAME, SPA_MAX_PARTS and
+// MAX_COMMAND_FRAME in components/gecko_spa). TWI_BUFFER_LENGTH in platformio.ini is
+// FRAME_MAX + 1, so longer frames still show up as oversize.
+#define FRAME_MAX 78            // Largest spa message, a full multi-part message part
+#define MAX_TX_FRAME 21         // Largest command to the spa, a word write
+
+// I2C receive ring: single producer (receiveEvent ISR), single consumer (loop).
+// Each slot is laid out as a link frame ([type][len_lo][len_hi][data...][crc])
+// so V2 forwarding encodes straight from the slot without copying.
+#define RING_SLOTS 8            // Power of two, holds a full 8-part config burst
+#define SLOT_DATA 3             // Offset of the I2C bytes within a slot
+
+uint8_t ring[RING_SLOTS][SLOT_DATA + FRAME_MAX + 1];
+uint8_t ringLen[RING_SLOTS];
+unsigned long ringTime[RING_SLOTS];     // micros() when receiveEvent ran
+volatile uint8_t ringHead = 0;          // Frames produced (free-running, ISR only)
+volatile uint8_t ringTail = 0;          // Frames consumed (free-running, loop only)
+volatile uint16_t ringOverflows = 0;    // Frames dropped because the ring was full
+volatile uint16_t ringOversize = 0;     // Frames dropped for exceeding FRAME_MAX
+uint16_t reportedOverflows = 0;
+uint16_t reportedOversize = 0;
+
+// Keep the compiler from moving slot accesses across head/tail updates
+#define MEMORY_BARRIER() __asm__ __volatile__("" ::: "memory")
+
+// I2C transmit queue. Commands from the ESP and handshake ACKs are queued and sent from
+// loop() one transaction at a time once the bus has been quiet for BUS_QUIET_US. Wire
+// stays in slave mode throughout: the TWI returns to the slave receiver after every
+// master transaction, and if the spa wins arbitration by addressing us the frame is
+// received as a normal slave write. NACKs and lost arbitration are retried with backoff.
+#define TX_SLOTS 4                      // Power of two
+#define TX_MAX_ATTEMPTS 4
+#define TX_BACKOFF_US 2000UL            // Doubled after each failed attempt
+#define TX_BUSY_TIMEOUT_US 100000UL     // Give up if the bus never goes idle
+#define BUS_QUIET_US 1000UL             // Time since the last received frame
+#define WIRE_TIMEOUT_US 5000UL          // Abort a transaction stuck on a held bus
+
+struct TxSlot {
+    uint8_t data[MAX_TX_FRAME];
+    uint8_t len;
+    uint8_t attempts;
+    bool report;                        // Print TX:OK / TX:ERR (not for auto-ACKs)
+    unsigned long queuedAt;             // micros()
+    unsigned long nextAttemptAt;        // micros()
+};
+
+TxSlot txQueue[TX_SLOTS];
+uint8_t txHead = 0;                     // Free-running, like the receive ring
+uint8_t txTail = 0;
+volatile unsigned long lastRxMicros = 0;
+
+// UART receive buffer (text line or binary frame), sized for the longest command:
+// TX: with MAX_TX_FRAME bytes of hex (a binary TX frame is shorter)
+char uartBuffer[3 + MAX_TX_FRAME * 2 + 1];
+uint8_t uartBufferPos = 0;
+bool uartInFrame = false;
+bool uartOverflow = false;      // Current line or frame didn't fit uartBuffer
+
+// Set by MODE:V2 from the ESP, cleared on reset (always boots in V1)
+bool linkV2 = false;
+
+// Bus capture (CAPTURE:1, V2 link only). Received frames are forwarded as 'C' frames
+// stamped with the micros() taken in receiveEvent, which the TWI interrupt runs as the
+// frame ends, and every transmit attempt is reported with its start time and
+// endTransmission() result. Multi-part messages are not reassembled while capturing.
+// Payload: event, result, micros (4, little-endian), I2C bytes
+#define CAPTURE_RX 'R'
+#define CAPTURE_TX 'T'
+#define CAPTURE_HEADER 6
+bool captureMode = false;
+
+// Multi-part reassembly with duplicate suppression (DEDUP:1, V2 link only).
+// Parts (byte[1]=0x09, byte[9]=0x01 while more follow) are held in the ring until
+// the last one arrives, then forwarded as one 'M' frame with the 16-byte part
+// headers stripped, but only if the payload changed or the refresh interval passed.
+#define PART_HEADER_LEN 16
+#define PART_TIMEOUT_MS 200UL       // Give up waiting and forward parts as-is
+#define DEDUP_REFRESH_MS 60000UL    // Forward unchanged messages at least this often
+#define DEDUP_ENTRIES 2             // Status and config+status messages
+
+struct DedupEntry {
+    uint16_t len;
+    uint16_t hash;
+    unsigned long sentAt;
+};
+
+bool dedupMode = false;
+DedupEntry dedup[DEDUP_ENTRIES];
+bool partsWaiting = false;
+bool partsRaw = false;          // Rest of a message whose earlier part went out as-is
+unsigned long partsWaitStart = 0;
+
+// Autonomous handshake acknowledgement (ACK:1). The 33-byte XML-name messages and
+// the 22-byte 'K' clock message are ACKed as soon as they are received, and still
+// forwarded so the ESP can parse them.
+const uint8_t ACK_MESSAGE[15] = {
+    0x17, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02
+};
+
+bool autoAck = false;
+uint8_t ringAckScan = 0;        // Frames checked for auto-ACK (free-running, loop only)
+uint16_t ackDrops = 0;          // ACKs that found the transmit queue full of ACKs
 
 // Hex conversion helpers
 uint8_t hexCharToNibble(char c) {
@@ -30,13 +136,162 @@ void printHex(uint8_t b) {
     Serial.print(b, HEX);
 }
 
+// Frame body gathered from several buffers (header, ring slots, crc)
+#define MAX_SEGMENTS (RING_SLOTS + 2)
+struct Segments {
+    const uint8_t* ptr[MAX_SEGMENTS];
+    uint8_t len[MAX_SEGMENTS];
+    uint8_t count;
+
+    void add(const uint8_t* p, uint8_t n) {
+        ptr[count] = p;
+        len[count++] = n;
+    }
+};
+
+// Write a frame body as one COBS-encoded, delimited frame. Each block's code byte
+// is found by scanning ahead in the source, so no second buffer is needed.
+void writeCobs(const Segments& src) {
+    Serial.write((uint8_t)LINK_DELIMITER);
+    uint8_t seg = 0, off = 0;
+    while (true) {
+        // Scan ahead for the next zero, the end, or a full 254-byte block
+        uint8_t s = seg, o = off, run = 0;
+        bool zero = false;
+        while (run < 254 && s < src.count) {
+            if (o >= src.len[s]) {
+                s++;
+                o = 0;
+            } else if (src.ptr[s][o] == 0) {
+                zero = true;
+                break;
+            } else {
+                run++;
+                o++;
+            }
+        }
+
+        Serial.write((uint8_t)(run + 1));
+        while (run > 0) {
+            if (off >= src.len[seg]) {
+                seg++;
+                off = 0;
+                continue;
+            }
+            uint8_t n = src.len[seg] - off;
+            if (n > run) n = run;
+            Serial.write(src.ptr[seg] + off, n);
+            off += n;
+            run -= n;
+        }
+
+        // A zero is implied by the code byte; a full 254-byte block implies none
+        if (zero) {
+            seg = s;
+            off = o + 1;
+        } else if (s >= src.count) {
+            break;
+        }
+    }
+    Serial.write((uint8_t)LINK_DELIMITER);
+}
+
+// Decode a COBS block in place, returns decoded length (0 on malformed input)
+uint16_t decodeCobs(uint8_t* buf, uint16_t len) {
+    uint16_t in = 0, out = 0;
+    while (in < len) {
+        uint8_t code = buf[in++];
+        if (code == 0 || in + code - 1 > len) return 0;
+        for (uint8_t i = 1; i < code; i++) buf[out++] = buf[in++];
+        if (code != 0xFF && in < len) buf[out++] = 0;
+    }
+    return out;
+}
+
+// Send a frame whose payload is already at frame[SLOT_DATA] (with one spare byte
+// after it for the crc), filling in the header in place
+void sendFrame(uint8_t type, uint8_t* frame, uint8_t len) {
+    frame[0] = type;
+    frame[1] = len;
+    frame[2] = 0;
+
+    uint8_t crc = 0;
+    for (uint8_t i = 0; i < len + SLOT_DATA; i++) crc = _crc8_ccitt_update(crc, frame[i]);
+    frame[len + SLOT_DATA] = crc;
+
+    Segments body = {};
+    body.add(frame, len + LINK_FRAME_OVERHEAD);
+    writeCobs(body);
+}
+
+// Send a reassembled multi-part message as one 'M' frame, straight from the ring
+void sendMessageFrame(uint8_t parts, uint16_t total) {
+    uint8_t header[3] = {LINK_FRAME_MSG, (uint8_t)(total & 0xFF), (uint8_t)(total >> 8)};
+    Segments body = {};
+    body.add(header, 3);
+
+    uint8_t crc = 0;
+    for (uint8_t i = 0; i < 3; i++) crc = _crc8_ccitt_update(crc, header[i]);
+    for (uint8_t p = 0; p < parts; p++) {
+        uint8_t slot = (ringTail + p) & (RING_SLOTS - 1);
+        const uint8_t* payload = ring[slot] + SLOT_DATA + PART_HEADER_LEN;
+        uint8_t len = ringLen[slot] - PART_HEADER_LEN;
+        for (uint8_t i = 0; i < len; i++) crc = _crc8_ccitt_update(crc, payload[i]);
+        body.add(payload, len);
+    }
+    body.add(&crc, 1);
+
+    writeCobs(body);
+}
+
+// Send a bus event as a 'C' frame
+void sendCaptureFrame(uint8_t event, uint8_t result, unsigned long time, const uint8_t* data, uint8_t len) {
+    uint8_t header[SLOT_DATA + CAPTURE_HEADER] = {
+        LINK_FRAME_CAPTURE, (uint8_t)(len + CAPTURE_HEADER), 0, event, result,
+        (uint8_t)time, (uint8_t)(time >> 8), (uint8_t)(time >> 16), (uint8_t)(time >> 24)
+    };
+    uint8_t crc = 0;
+    for (uint8_t i = 0; i < sizeof(header); i++) crc = _crc8_ccitt_update(crc, header[i]);
+    for (uint8_t i = 0; i < len; i++) crc = _crc8_ccitt_update(crc, data[i]);
+
+    Segments body = {};
+    body.add(header, sizeof(header));
+    body.add(data, len);
+    body.add(&crc, 1);
+    writeCobs(body);
+}
+
 // I2C event handlers
 void receiveEvent(int numBytes) {
-    i2cBufferLen = 0;
-    while (Wire.available() && i2cBufferLen < 128) {
-        i2cBuffer[i2cBufferLen++] = Wire.read();
+    unsigned long now = micros();
+    lastRxMicros = now;
+    uint8_t head = ringHead;
+    if ((uint8_t)(head - ringTail) >= RING_SLOTS) {
+        while (Wire.available()) Wire.read();
+        ringOverflows++;
+        return;
     }
-    newI2CMessage = true;
+
+    uint8_t slot = head & (RING_SLOTS - 1);
+    uint8_t len = 0;
+    bool oversize = false;
+    while (Wire.available()) {
+        uint8_t b = Wire.read();
+        if (len < FRAME_MAX) {
+            ring[slot][SLOT_DATA + len++] = b;
+        } else {
+            oversize = true;
+        }
+    }
+    if (oversize) {
+        ringOversize++;
+        return;
+    }
+
+    ringLen[slot] = len;
+    ringTime[slot] = now;
+    MEMORY_BARRIER();
+    ringHead = head + 1;
 }
 
 void requestEvent() {
@@ -45,27 +300,123 @@ void requestEvent() {
     Wire.write((uint8_t)0x00);
 }
 
-// Send bytes to I2C bus
-void sendToI2C(uint8_t* data, uint8_t len) {
-    // Temporarily become master to send
-    Wire.end();
-    Wire.begin();
+// Queue bytes for the I2C bus; front puts them ahead of anything already waiting
+bool queueTx(const uint8_t* data, uint8_t len, bool report, bool front = false) {
+    if ((uint8_t)(txHead - txTail) >= TX_SLOTS) return false;
+
+    uint8_t index = front ? --txTail : txHead++;
+    TxSlot& tx = txQueue[index & (TX_SLOTS - 1)];
+    memcpy(tx.data, data, len);
+    tx.len = len;
+    tx.attempts = 0;
+    tx.report = report;
+    tx.queuedAt = micros();
+    tx.nextAttemptAt = tx.queuedAt;
+    return true;
+}
+
+void queueCommand(const uint8_t* data, uint8_t len) {
+    if (!queueTx(data, len, true)) Serial.println("TX:ERR:QUEUE_FULL");
+}
+
+// No frame received for BUS_QUIET_US and both lines released
+bool busIdle() {
+    noInterrupts();
+    unsigned long last = lastRxMicros;
+    interrupts();
+    return micros() - last >= BUS_QUIET_US && digitalRead(SDA) == HIGH && digitalRead(SCL) == HIGH;
+}
 
+// One master transaction: write, then repeated-start and read 2 bytes (the spa
+// expects this). Returns the endTransmission() result of the write.
+uint8_t transmit(const uint8_t* data, uint8_t len) {
     Wire.beginTransmission(SPA_ADDRESS);
     Wire.write(data, len);
-    Wire.endTransmission(false);
+    uint8_t result = Wire.endTransmission(false);
+    if (result != 0) return result;
 
-    // Read 2 bytes (spa expects this)
+    // Drain straight away: Wire ignores slave writes while read bytes are pending
     Wire.requestFrom((uint8_t)SPA_ADDRESS, (uint8_t)2);
     while (Wire.available()) Wire.read();
+    return 0;
+}
 
-    // Return to slave mode
-    Wire.end();
-    Wire.begin(SPA_ADDRESS);
-    Wire.onReceive(receiveEvent);
-    Wire.onRequest(requestEvent);
+const char* txErrorReason(uint8_t result) {
+    switch (result) {
+        case 2: return "NACK_ADDR";
+        case 3: return "NACK_DATA";
+        case 4: return "ARB_LOST";      // Or a bus error, the TWI driver doesn't tell them apart
+        case 5: return "TIMEOUT";
+        default: return "BUS";
+    }
+}
 
-    Serial.println("TX:OK");
+// Report the result of the oldest queued frame and drop it.
+// TX:OK:<latency_us> or TX:ERR:<reason>:<latency_us>, latency measured from queueing.
+void finishTx(const char* reason) {
+    TxSlot& tx = txQueue[txTail & (TX_SLOTS - 1)];
+    if (tx.report) {
+        unsigned long latency = micros() - tx.queuedAt;
+        if (reason) {
+            Serial.print("TX:ERR:");
+            Serial.print(reason);
+            Serial.print(":");
+        } else {
+            Serial.print("TX:OK:");
+        }
+        Serial.println(latency);
+    }
+    txTail++;
+}
+
+// Attempt the oldest queued frame if its backoff has passed and the bus is idle
+void serviceTx() {
+    if (txTail == txHead) return;
+
+    TxSlot& tx = txQueue[txTail & (TX_SLOTS - 1)];
+    unsigned long now = micros();
+    if ((long)(now - tx.nextAttemptAt) < 0) return;
+    if (!busIdle()) {
+        if (now - tx.queuedAt >= TX_BUSY_TIMEOUT_US) finishTx("BUS_BUSY");
+        return;
+    }
+
+    unsigned long start = micros();
+    uint8_t result = transmit(tx.data, tx.len);
+    tx.attempts++;
+    if (captureMode && linkV2) sendCaptureFrame(CAPTURE_TX, result, start, tx.data, tx.len);
+    if (result == 0) {
+        finishTx(nullptr);
+    } else if (result >= 2 && result <= 4 && tx.attempts < TX_MAX_ATTEMPTS) {
+        tx.nextAttemptAt = micros() + (TX_BACKOFF_US << (tx.attempts - 1));
+    } else {
+        finishTx(txErrorReason(result));
+    }
+}
+
+// Process binary frame from ESP (COBS-encoded, delimiters stripped)
+void processLinkFrame(uint8_t* buf, uint16_t len) {
+    len = decodeCobs(buf, len);
+    if (len < LINK_FRAME_OVERHEAD) {
+        Serial.println("TX:ERR:BAD_FRAME");
+        return;
+    }
+
+    uint16_t payloadLen = buf[1] | (buf[2] << 8);
+    uint8_t crc = 0;
+    for (uint16_t i = 0; i < len - 1; i++) crc = _crc8_ccitt_update(crc, buf[i]);
+    if (payloadLen != len - LINK_FRAME_OVERHEAD || crc != buf[len - 1]) {
+        Serial.println("TX:ERR:BAD_FRAME");
+        return;
+    }
+
+    if (buf[0] == LINK_FRAME_TX) {
+        if (payloadLen > MAX_TX_FRAME) {
+            Serial.println("TX:ERR:TOO_LONG");
+            return;
+        }
+        queueCommand(buf + 3, payloadLen);
+    }
 }
 
 // Process UART command
@@ -80,24 +431,220 @@ void processUartCommand(const char* cmd) {
             return;
         }
 
-        uint8_t data[128];
         uint8_t dataLen = hexLen / 2;
-
-        if (dataLen > 128) {
+        if (dataLen > MAX_TX_FRAME) {
             Serial.println("TX:ERR:TOO_LONG");
             return;
         }
 
+        // Decode in place: byte i is written well behind the hex digits still to be read
+        uint8_t* data = (uint8_t*)uartBuffer;
         for (uint8_t i = 0; i < dataLen; i++) {
             data[i] = hexToByte(hex[i*2], hex[i*2+1]);
         }
 
-        sendToI2C(data, dataLen);
+        queueCommand(data, dataLen);
     }
     // PING - health check
     else if (strcmp(cmd, "PING") == 0) {
         Serial.println("PONG");
     }
+    // MODE:V1 / MODE:V2 - select RX encoding (acknowledged before switching)
+    else if (strcmp(cmd, "MODE:V2") == 0) {
+        Serial.println("MODE:V2");
+        linkV2 = true;
+    }
+    else if (strcmp(cmd, "MODE:V1") == 0) {
+        Serial.println("MODE:V1");
+        linkV2 = false;
+    }
+    // ACK:1 / ACK:0 - acknowledge handshake messages without waiting for the ESP
+    else if (strcmp(cmd, "ACK:1") == 0) {
+        autoAck = true;
+        ringAckScan = ringHead;
+        Serial.println("ACK:ON");
+    }
+    else if (strcmp(cmd, "ACK:0") == 0) {
+        autoAck = false;
+        Serial.println("ACK:OFF");
+    }
+    // DEDUP:1 / DEDUP:0 - multi-part reassembly and duplicate suppression
+    else if (strcmp(cmd, "DEDUP:1") == 0) {
+        dedupMode = true;
+        memset(dedup, 0, sizeof(dedup));
+        Serial.println("DEDUP:ON");
+    }
+    else if (strcmp(cmd, "DEDUP:0") == 0) {
+        dedupMode = false;
+        Serial.println("DEDUP:OFF");
+    }
+    // CAPTURE:1 / CAPTURE:0 - timestamped bus capture
+    else if (strcmp(cmd, "CAPTURE:1") == 0) {
+        captureMode = true;
+        Serial.println("CAPTURE:ON");
+    }
+    else if (strcmp(cmd, "CAPTURE:0") == 0) {
+        captureMode = false;
+        Serial.println("CAPTURE:OFF");
+    }
+}
+
+// Report ring drops upstream as OVF:<overflows>:<oversize> (totals since boot)
+void reportDrops() {
+    noInterrupts();
+    uint16_t overflows = ringOverflows;
+    uint16_t oversize = ringOversize;
+    interrupts();
+
+    if (overflows == reportedOverflows && oversize == reportedOversize) return;
+    reportedOverflows = overflows;
+    reportedOversize = oversize;
+
+    Serial.print("OVF:");
+    Serial.print(overflows);
+    Serial.print(":");
+    Serial.println(oversize);
+}
+
+bool isHandshake(const uint8_t* data, uint8_t len) {
+    return len == 33 || (len == 22 && data[13] == 0x4B);  // XML name, 'K' clock
+}
+
+// Make room for an ACK in a full transmit queue by dropping the newest command, which
+// is reported as TX:ERR:QUEUE_FULL (the ESP resends commands the spa doesn't confirm).
+// A queue holding only ACKs is left alone.
+bool evictNewestCommand() {
+    if ((uint8_t)(txHead - txTail) < TX_SLOTS) return true;
+    TxSlot& newest = txQueue[(uint8_t)(txHead - 1) & (TX_SLOTS - 1)];
+    if (!newest.report || newest.attempts > 0) return false;
+    Serial.println("TX:ERR:QUEUE_FULL");
+    txHead--;
+    return true;
+}
+
+// ACK handshake messages as soon as they arrive, ahead of any forwarding backlog.
+// An ACK that can't be queued is reported as ACK:DROP:<total since boot>.
+void ackHandshakes() {
+    while (ringAckScan != ringHead) {
+        MEMORY_BARRIER();
+        uint8_t slot = ringAckScan & (RING_SLOTS - 1);
+        if (isHandshake(ring[slot] + SLOT_DATA, ringLen[slot])) {
+            if (!evictNewestCommand() || !queueTx(ACK_MESSAGE, sizeof(ACK_MESSAGE), false, true)) {
+                ackDrops++;
+                Serial.print("ACK:DROP:");
+                Serial.println(ackDrops);
+            }
+        }
+        ringAckScan++;
+    }
+}
+
+// Forward the oldest frame in the ring as binary frame (V2) or hex line (V1)
+void forwardOldest() {
+    uint8_t slot = ringTail & (RING_SLOTS - 1);
+    uint8_t len = ringLen[slot];
+
+    if (linkV2 && captureMode) {
+        sendCaptureFrame(CAPTURE_RX, 0, ringTime[slot], ring[slot] + SLOT_DATA, len);
+    } else if (linkV2) {
+        sendFrame(LINK_FRAME_RX, ring[slot], len);
+    } else {
+        Serial.print("RX:");
+        Serial.print(len);
+        Serial.print(":");
+        for (uint8_t i = 0; i < len; i++) {
+            printHex(ring[slot][SLOT_DATA + i]);
+        }
+        Serial.println();
+    }
+
+    MEMORY_BARRIER();
+    ringTail++;  // Hand the slot back to receiveEvent
+}
+
+bool isMessagePart(const uint8_t* data, uint8_t len) {
+    return len >= PART_HEADER_LEN && data[1] == 0x09;
+}
+
+// The checks the ESP applies to parts it reassembles itself: the XOR checksum in the
+// last byte, and only the last part of a message may be short (otherwise parts are missing)
+bool isValidPart(const uint8_t* data, uint8_t len) {
+    uint8_t checksum = 0;
+    for (uint8_t i = 0; i < len - 1; i++) checksum ^= data[i];
+    if (checksum != data[len - 1]) return false;
+    return data[9] != 0x01 || len == FRAME_MAX;
+}
+
+// Forward the oldest frame as-is. If it is a part with more to come, the rest of its
+// message follows as-is too, so the ESP discards the whole message as without dedup.
+void forwardOldestPart() {
+    uint8_t slot = ringTail & (RING_SLOTS - 1);
+    const uint8_t* data = ring[slot] + SLOT_DATA;
+    partsRaw = isMessagePart(data, ringLen[slot]) && data[9] == 0x01;
+    forwardOldest();
+}
+
+// Dedup mode: hold multi-part messages until complete, then forward them only if
+// they changed. Anything that is not a complete message of valid parts goes out as-is,
+// so the ESP counts and discards corrupt or missing parts as without dedup.
+void forwardMessages() {
+    if (partsRaw) {
+        forwardOldestPart();
+        return;
+    }
+    uint8_t avail = ringHead - ringTail;
+    uint8_t parts = 0;
+    uint16_t total = 0;
+    uint16_t hash = 0xFFFF;
+    bool complete = false;
+
+    while (parts < avail && !complete) {
+        uint8_t slot = (ringTail + parts) & (RING_SLOTS - 1);
+        const uint8_t* data = ring[slot] + SLOT_DATA;
+        uint8_t len = ringLen[slot];
+        if (!isMessagePart(data, len) || !isValidPart(data, len)) break;
+
+        for (uint8_t i = PART_HEADER_LEN; i < len; i++) hash = _crc16_update(hash, data[i]);
+        total += len - PART_HEADER_LEN;
+        complete = (data[9] != 0x01);
+        parts++;
+    }
+
+    if (!complete) {
+        // Still collecting parts: wait unless the ring is full or the rest never came
+        if (parts > 0 && parts == avail && avail < RING_SLOTS) {
+            if (!partsWaiting) {
+                partsWaiting = true;
+                partsWaitStart = millis();
+            }
+            if (millis() - partsWaitStart < PART_TIMEOUT_MS) return;
+        }
+        partsWaiting = false;
+        forwardOldestPart();
+        return;
+    }
+    partsWaiting = false;
+
+    // Last hash per message length; the least recently sent entry is replaced
+    unsigned long now = millis();
+    DedupEntry* entry = &dedup[0];
+    for (uint8_t i = 0; i < DEDUP_ENTRIES; i++) {
+        if (dedup[i].len == total) {
+            entry = &dedup[i];
+            break;
+        }
+        if (dedup[i].sentAt < entry->sentAt) entry = &dedup[i];
+    }
+
+    if (entry->len != total || entry->hash != hash || now - entry->sentAt >= DEDUP_REFRESH_MS) {
+        sendMessageFrame(parts, total);
+        entry->len = total;
+        entry->hash = hash;
+        entry->sentAt = now;
+    }
+
+    MEMORY_BARRIER();
+    ringTail += parts;
 }
 
 void setup() {
@@ -105,39 +652,69 @@ void setup() {
     delay(100);
 
     Serial.println("I2C_PROXY:V1");
+    Serial.println("I2C_PROXY:V2");
 
     Wire.begin(SPA_ADDRESS);
     Wire.onReceive(receiveEvent);
     Wire.onRequest(requestEvent);
+#ifdef WIRE_HAS_TIMEOUT
+    Wire.setWireTimeout(WIRE_TIMEOUT_US, true);
+#endif
 
     Serial.println("READY");
 }
 
 void loop() {
-    // Forward I2C messages to UART as hex
-    if (newI2CMessage) {
-        newI2CMessage = false;
+    if (autoAck) {
+        ackHandshakes();
+    }
 
-        Serial.print("RX:");
-        Serial.print(i2cBufferLen);
-        Serial.print(":");
-        for (uint8_t i = 0; i < i2cBufferLen; i++) {
-            printHex(i2cBuffer[i]);
+    // Forward received I2C messages, one frame (or one reassembled message) per
+    // pass so UART commands are still serviced during a burst
+    if (ringTail != ringHead) {
+        MEMORY_BARRIER();
+        if (dedupMode && linkV2 && !captureMode) {
+            forwardMessages();
+        } else {
+            forwardOldest();
         }
-        Serial.println();
     }
 
-    // Process UART commands
+    serviceTx();
+    reportDrops();
+
+    // Process UART commands (text lines or 0x00-delimited binary frames)
     while (Serial.available()) {
         char c = Serial.read();
-        if (c == '\n' || c == '\r') {
+        if (c == LINK_DELIMITER) {
+            // Closing delimiter of a non-empty frame, otherwise an opening one
+            if (uartInFrame && uartBufferPos > 0) {
+                if (uartOverflow) {
+                    Serial.println("TX:ERR:TOO_LONG");
+                } else {
+                    processLinkFrame((uint8_t*)uartBuffer, uartBufferPos);
+                }
+                uartInFrame = false;
+            } else {
+                uartInFrame = true;
+            }
+            uartBufferPos = 0;
+            uartOverflow = false;
+        } else if (!uartInFrame && (c == '\n' || c == '\r')) {
             if (uartBufferPos > 0) {
                 uartBuffer[uartBufferPos] = '\0';
-                processUartCommand(uartBuffer);
+                if (!uartOverflow) {
+                    processUartCommand(uartBuffer);
+                } else if (strncmp(uartBuffer, "TX:", 3) == 0) {
+                    Serial.println("TX:ERR:TOO_LONG");
+                }
                 uartBufferPos = 0;
             }
+            uartOverflow = false;
         } else if (uartBufferPos < sizeof(uartBuffer) - 1) {
             uartBuffer[uartBufferPos++] = c;
+        } else {
+            uartOverflow = true;
         }
     }
 }
@@ -1,8 +1,8 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome import pins
+from esphome import automation, pins
 from esphome.components import uart
-from esphome.const import CONF_ID
+from esphome.const import CONF_ID, CONF_POSITION, CONF_TYPE, CONF_VALUE
 
 DEPENDENCIES = ["uart"]
 AUTO_LOAD = ["climate", "switch", "select", "binary_sensor", "text_sensor"]
@@ -10,6 +10,18 @@ AUTO_LOAD = ["climate", "switch", "select", "binary_sensor", "text_sensor"]
 CONF_UART_ID = "uart_id"
 CONF_RESET_PIN = "reset_pin"
 CONF_NOTIF_DATE_FORMAT = "notif_date_format"
+CONF_BINARY_LINK = "binary_link"
+CONF_PROXY_DEDUP = "proxy_dedup"
+CONF_PROXY_AUTO_ACK = "proxy_auto_ack"
+CONF_TRACE_BUFFER_SIZE = "trace_buffer_size"
+CONF_VERBOSE_LOG = "verbose_log"
+CONF_METRICS_INTERVAL = "metrics_interval"
+CONF_SNAPSHOT_INTERVAL = "snapshot_interval"
+CONF_RX_TASK = "rx_task"
+CONF_MIN_PUBLISH_INTERVAL = "min_publish_interval"
+CONF_DEVICE_POWER = "device_power"
+CONF_METER_SAVE_INTERVAL = "meter_save_interval"
+CONF_METER_PUBLISH_INTERVAL = "meter_publish_interval"
 
 gecko_spa_ns = cg.esphome_ns.namespace("gecko_spa")
 GeckoSpa = gecko_spa_ns.class_("GeckoSpa", cg.Component, uart.UARTDevice)
@@ -20,12 +32,53 @@ NOTIF_DATE_FORMATS = {
     "D-M-Y": NotifDateFormat.D_M_Y,
 }
 
+PublishEntity = gecko_spa_ns.enum("PublishEntity", is_class=True)
+
+MeteredDevice = gecko_spa_ns.enum("MeteredDevice", is_class=True)
+# Devices with run time and energy sensors, keyed as in device_power
+METERED_DEVICES = {
+    "heater": MeteredDevice.HEATER,
+    "circulation": MeteredDevice.CIRCULATION,
+    "blower": MeteredDevice.BLOWER,
+    "pump1": MeteredDevice.PUMP1,
+    "pump2": MeteredDevice.PUMP2,
+    "pump3": MeteredDevice.PUMP3,
+    "pump4": MeteredDevice.PUMP4,
+}
+
+WriteAction = gecko_spa_ns.class_("WriteAction", automation.Action)
+FieldType = gecko_spa_ns.enum("FieldType", is_class=True)
+# Value types gecko_spa.write accepts: byte and word are raw, temp is in degC
+WRITE_TYPES = {
+    "byte": FieldType.BYTE,
+    "word": FieldType.WORD,
+    "temp": FieldType.TEMP,
+}
+
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(GeckoSpa),
         cv.GenerateID(CONF_UART_ID): cv.use_id(uart.UARTComponent),
         cv.Optional(CONF_RESET_PIN): pins.gpio_output_pin_schema,
         cv.Optional(CONF_NOTIF_DATE_FORMAT, default="D-M-Y"): cv.enum(NOTIF_DATE_FORMATS, upper=True),
+        cv.Optional(CONF_BINARY_LINK, default=True): cv.boolean,
+        cv.Optional(CONF_PROXY_DEDUP, default=False): cv.boolean,
+        cv.Optional(CONF_PROXY_AUTO_ACK, default=False): cv.boolean,
+        cv.Optional(CONF_TRACE_BUFFER_SIZE, default=4096): cv.int_range(min=0, max=65535),
+        cv.Optional(CONF_VERBOSE_LOG, default=False): cv.boolean,
+        cv.Optional(CONF_METRICS_INTERVAL, default="60s"): cv.positive_time_period_milliseconds,
+        # Minimum time between snapshot writes to flash; 0s disables the snapshot
+        cv.Optional(CONF_SNAPSHOT_INTERVAL, default="10min"): cv.positive_time_period_milliseconds,
+        # Receive and ACK in a dedicated FreeRTOS task instead of loop() (ESP32 only)
+        cv.Optional(CONF_RX_TASK, default=False): cv.boolean,
+        # Power draw of each device while on, for the energy sensors
+        cv.Optional(CONF_DEVICE_POWER, default={}): cv.Schema(
+            {cv.Optional(name): cv.All(cv.power, cv.float_range(min=0, max=65535)) for name in METERED_DEVICES}
+        ),
+        # Minimum time between meter total writes to flash; 0s keeps totals since boot only
+        cv.Optional(CONF_METER_SAVE_INTERVAL, default="1h"): cv.positive_time_period_milliseconds,
+        # Minimum time between publishes of the run time and energy sensors, shared by all of them
+        cv.Optional(CONF_METER_PUBLISH_INTERVAL, default="60s"): cv.positive_time_period_milliseconds,
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -43,3 +96,64 @@ async def to_code(config):
 
     if CONF_NOTIF_DATE_FORMAT in config:
         cg.add(var.set_notif_date_format(config[CONF_NOTIF_DATE_FORMAT]))
+
+    cg.add(var.set_binary_link(config[CONF_BINARY_LINK]))
+    cg.add(var.set_proxy_dedup(config[CONF_PROXY_DEDUP]))
+    cg.add(var.set_proxy_auto_ack(config[CONF_PROXY_AUTO_ACK]))
+    cg.add(var.set_trace_buffer_size(config[CONF_TRACE_BUFFER_SIZE]))
+    cg.add(var.set_metrics_interval(config[CONF_METRICS_INTERVAL]))
+    cg.add(var.set_snapshot_interval(config[CONF_SNAPSHOT_INTERVAL]))
+    cg.add(var.set_rx_task(config[CONF_RX_TASK]))
+    for name, watts in config[CONF_DEVICE_POWER].items():
+        cg.add(var.set_device_power(METERED_DEVICES[name], round(watts)))
+    cg.add(var.set_meter_save_interval(config[CONF_METER_SAVE_INTERVAL]))
+    cg.add(var.set_publish_interval(PublishEntity.METERS, config[CONF_METER_PUBLISH_INTERVAL]))
+    if config[CONF_VERBOSE_LOG]:
+        cg.add_define("GECKO_SPA_VERBOSE_LOG")
+
+
+# Entities published from status messages take min_publish_interval: changes within the
+# interval are coalesced and the latest state is published when it is up.
+MIN_PUBLISH_INTERVAL_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_MIN_PUBLISH_INTERVAL): cv.positive_time_period_milliseconds,
+    }
+)
+
+
+# For platforms with other entity types too; publish_entities maps the types that are
+# published from status messages to their PublishEntity
+def validate_publish_interval(publish_entities):
+    def validate(config):
+        if CONF_MIN_PUBLISH_INTERVAL in config and config[CONF_TYPE] not in publish_entities:
+            raise cv.Invalid(f"{CONF_MIN_PUBLISH_INTERVAL} is not supported for type {config[CONF_TYPE]}")
+        return config
+
+    return validate
+
+
+async def set_publish_interval(parent, entity, config):
+    if CONF_MIN_PUBLISH_INTERVAL in config:
+        cg.add(parent.set_publish_interval(entity, config[CONF_MIN_PUBLISH_INTERVAL]))
+
+
+@automation.register_action(
+    "gecko_spa.write",
+    WriteAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(GeckoSpa),
+            cv.Required(CONF_POSITION): cv.int_range(min=0, max=0xFFFF),
+            cv.Optional(CONF_TYPE, default="byte"): cv.enum(WRITE_TYPES, lower=True),
+            cv.Required(CONF_VALUE): cv.templatable(cv.float_),
+        }
+    ),
+)
+async def write_action_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    cg.add(var.set_position(config[CONF_POSITION]))
+    cg.add(var.set_type(config[CONF_TYPE]))
+    templ = await cg.templatable(config[CONF_VALUE], args, float)
+    cg.add(var.set_value(templ))
+    return var
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "gecko_spa.h"
+
+namespace esphome {
+namespace gecko_spa {
+
+// gecko_spa.write: write a value to a writable field by struct position (see
+// GeckoSpa::write_field)
+template<typename... Ts> class WriteAction : public Action<Ts...>, public Parented<GeckoSpa> {
+ public:
+  TEMPLATABLE_VALUE(float, value)
+  void set_position(uint16_t pos) { pos_ = pos; }
+  void set_type(FieldType type) { type_ = type; }
+
+  void play(Ts... x) override { this->parent_->write_value(pos_, type_, this->value_.value(x...)); }
+
+ protected:
+  uint16_t pos_{0};
+  FieldType type_{FieldType::BYTE};
+};
+
+}  // namespace gecko_spa
+}  // namespace esphome
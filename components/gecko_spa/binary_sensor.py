@@ -2,7 +2,14 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import binary_sensor
 from esphome.const import CONF_ID
-from . import gecko_spa_ns, GeckoSpa
+from . import (
+    gecko_spa_ns,
+    GeckoSpa,
+    MIN_PUBLISH_INTERVAL_SCHEMA,
+    PublishEntity,
+    set_publish_interval,
+    validate_publish_interval,
+)
 
 DEPENDENCIES = ["gecko_spa"]
 
@@ -14,13 +21,26 @@ SENSOR_TYPES = {
     "connected": "CONNECTED",
     "waterfall": "WATERFALL",
     "blower": "BLOWER",
+    "stale": "STALE",
+}
+
+# Types published from status messages
+PUBLISH_ENTITIES = {
+    "standby": PublishEntity.STANDBY,
+    "waterfall": PublishEntity.WATERFALL,
+    "blower": PublishEntity.BLOWER,
 }
 
-CONFIG_SCHEMA = binary_sensor.binary_sensor_schema().extend(
-    {
-        cv.GenerateID(CONF_GECKO_SPA_ID): cv.use_id(GeckoSpa),
-        cv.Required(CONF_SENSOR_TYPE): cv.enum(SENSOR_TYPES, lower=True),
-    }
+CONFIG_SCHEMA = cv.All(
+    binary_sensor.binary_sensor_schema()
+    .extend(
+        {
+            cv.GenerateID(CONF_GECKO_SPA_ID): cv.use_id(GeckoSpa),
+            cv.Required(CONF_SENSOR_TYPE): cv.enum(SENSOR_TYPES, lower=True),
+        }
+    )
+    .extend(MIN_PUBLISH_INTERVAL_SCHEMA),
+    validate_publish_interval(PUBLISH_ENTITIES),
 )
 
 
@@ -29,6 +49,8 @@ async def to_code(config):
     var = await binary_sensor.new_binary_sensor(config)
 
     sensor_type = config[CONF_SENSOR_TYPE]
+    if sensor_type in PUBLISH_ENTITIES:
+        await set_publish_interval(parent, PUBLISH_ENTITIES[sensor_type], config)
     if sensor_type == "standby":
         cg.add(parent.set_standby_sensor(var))
     elif sensor_type == "connected":
@@ -37,3 +59,5 @@ async def to_code(config):
         cg.add(parent.set_waterfall_sensor(var))
     elif sensor_type == "blower":
         cg.add(parent.set_blower_sensor(var))
+    elif sensor_type == "stale":
+        cg.add(parent.set_stale_sensor(var))
@@ -2,7 +2,7 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import climate
 from esphome.const import CONF_ID, CONF_NAME
-from . import gecko_spa_ns, GeckoSpa
+from . import gecko_spa_ns, GeckoSpa, MIN_PUBLISH_INTERVAL_SCHEMA, PublishEntity, set_publish_interval
 
 DEPENDENCIES = ["gecko_spa"]
 
@@ -11,14 +11,18 @@ GeckoSpaClimate = gecko_spa_ns.class_(
 )
 
 CONF_GECKO_SPA_ID = "gecko_spa_id"
+# Change of the current temperature that is published; setpoint changes always are
+CONF_TEMPERATURE_HYSTERESIS = "temperature_hysteresis"
 
 CONFIG_SCHEMA = (
     climate.climate_schema(GeckoSpaClimate)
     .extend(
         {
             cv.GenerateID(CONF_GECKO_SPA_ID): cv.use_id(GeckoSpa),
+            cv.Optional(CONF_TEMPERATURE_HYSTERESIS, default=0.1): cv.positive_float,
         }
     )
+    .extend(MIN_PUBLISH_INTERVAL_SCHEMA)
     .extend(cv.COMPONENT_SCHEMA)
 )
 
@@ -29,3 +33,5 @@ async def to_code(config):
     await cg.register_component(var, config)
     await climate.register_climate(var, config)
     cg.add(parent.set_climate(var))
+    cg.add(parent.set_temperature_hysteresis(config[CONF_TEMPERATURE_HYSTERESIS]))
+    await set_publish_interval(parent, PublishEntity.CLIMATE, config)
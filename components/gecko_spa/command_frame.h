@@ -0,0 +1,121 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace esphome {
+namespace gecko_spa {
+
+// Frames sent to the spa:
+//   [0]       0x17
+//   [1]       frame type (below)
+//   [2-11]    00 00 00 17 09 00 00 00 00 00
+//   [12]      payload length
+//   [13..]    payload
+//   [last]    XOR of all preceding bytes
+// GO and the handshake ACK share the layout: GO's payload is 'G' and its checksum
+// happens to be 'O'.
+static const uint8_t FRAME_GO = 0x00;
+static const uint8_t FRAME_WRITE = 0x0A;  // FRQ memory writes and handshake ACKs
+static const uint8_t FRAME_PROGRAM = 0x0B;
+static const uint8_t FRAME_HEADER_LEN = 13;
+static const uint8_t MAX_FRAME_PAYLOAD = 7;  // Longest payload, a word write
+static const uint8_t MAX_COMMAND_FRAME = FRAME_HEADER_LEN + MAX_FRAME_PAYLOAD + 1;
+
+constexpr uint8_t frame_checksum(const uint8_t *data, size_t len) {
+  uint8_t xor_val = 0;
+  for (size_t i = 0; i < len; i++)
+    xor_val ^= data[i];
+  return xor_val;
+}
+
+// Build a frame into out (FRAME_HEADER_LEN + payload_len + 1 bytes), returns its length
+constexpr uint8_t build_frame(uint8_t type, const uint8_t *payload, uint8_t payload_len, uint8_t *out) {
+  const uint8_t header[FRAME_HEADER_LEN] = {0x17, type, 0x00, 0x00, 0x00, 0x17, 0x09,
+                                            0x00, 0x00, 0x00, 0x00, 0x00, payload_len};
+  uint8_t len = 0;
+  for (uint8_t i = 0; i < FRAME_HEADER_LEN; i++)
+    out[len++] = header[i];
+  for (uint8_t i = 0; i < payload_len; i++)
+    out[len++] = payload[i];
+  out[len] = frame_checksum(out, len);
+  return len + 1;
+}
+
+// Frame whose payload is fixed at compile time, built and checksummed by the compiler
+template<uint8_t Type, uint8_t... Payload> struct FixedFrame {
+  static_assert(sizeof...(Payload) >= 1 && sizeof...(Payload) <= MAX_FRAME_PAYLOAD, "Bad payload length");
+  static constexpr uint8_t LEN = FRAME_HEADER_LEN + sizeof...(Payload) + 1;
+  static constexpr std::array<uint8_t, LEN> build() {
+    std::array<uint8_t, LEN> frame{};
+    const uint8_t payload[] = {Payload...};
+    build_frame(Type, payload, sizeof...(Payload), frame.data());
+    return frame;
+  }
+  static constexpr std::array<uint8_t, LEN> BYTES = build();
+};
+
+using GoFrame = FixedFrame<FRAME_GO, 'G'>;
+using AckFrame = FixedFrame<FRAME_WRITE, 0x00>;
+static_assert(GoFrame::BYTES[14] == 'O', "GO frame ends with \"GO\"");
+static_assert(AckFrame::BYTES[14] == 0x02, "Handshake ACK checksum");
+
+// FRQ write of a byte or big-endian word at a spa memory position:
+// payload 'F' 'R' 'Q' pos_hi pos_lo value...
+static const uint8_t FRQ_PREFIX_LEN = 5;
+
+inline uint8_t build_write_frame(uint16_t pos, uint8_t width, uint16_t value, uint8_t *out) {
+  uint8_t payload[FRQ_PREFIX_LEN + 2] = {'F', 'R', 'Q', (uint8_t) (pos >> 8), (uint8_t) pos};
+  if (width == 2) {
+    payload[FRQ_PREFIX_LEN] = value >> 8;
+    payload[FRQ_PREFIX_LEN + 1] = value;
+  } else {
+    payload[FRQ_PREFIX_LEN] = value;
+  }
+  return build_frame(FRAME_WRITE, payload, FRQ_PREFIX_LEN + width, out);
+}
+
+// Write to a position known at compile time: only the value bytes are filled in at run
+// time, and folded into a checksum the compiler worked out for a zero value
+template<uint16_t Pos, uint8_t Width> struct FixedWrite {
+  static_assert(Width == 1 || Width == 2, "Spa fields are a byte or a word");
+  static constexpr uint8_t LEN = FRAME_HEADER_LEN + FRQ_PREFIX_LEN + Width + 1;
+  static constexpr std::array<uint8_t, LEN> build() {
+    std::array<uint8_t, LEN> frame{};
+    const uint8_t payload[FRQ_PREFIX_LEN + Width] = {'F', 'R', 'Q', (uint8_t) (Pos >> 8), (uint8_t) Pos};
+    build_frame(FRAME_WRITE, payload, FRQ_PREFIX_LEN + Width, frame.data());
+    return frame;
+  }
+  static constexpr std::array<uint8_t, LEN> ZERO = build();
+
+  static uint8_t fill(uint16_t value, uint8_t *out) {
+    memcpy(out, ZERO.data(), LEN);
+    uint8_t *v = out + FRAME_HEADER_LEN + FRQ_PREFIX_LEN;
+    if (Width == 2) {
+      v[0] = value >> 8;
+      v[1] = value;
+      out[LEN - 1] ^= v[0] ^ v[1];
+    } else {
+      v[0] = value;
+      out[LEN - 1] ^= v[0];
+    }
+    return LEN;
+  }
+};
+
+// Position and width of an FRQ write frame
+inline uint16_t write_frame_pos(const uint8_t *frame) {
+  return (frame[FRAME_HEADER_LEN + 3] << 8) | frame[FRAME_HEADER_LEN + 4];
+}
+inline uint8_t write_frame_width(const uint8_t *frame) { return frame[12] - FRQ_PREFIX_LEN; }
+
+// Program change: payload 4E 03 D0 <program>
+inline uint8_t build_program_frame(uint8_t prog, uint8_t *out) {
+  const uint8_t payload[4] = {0x4E, 0x03, 0xD0, prog};
+  return build_frame(FRAME_PROGRAM, payload, sizeof(payload), out);
+}
+
+}  // namespace gecko_spa
+}  // namespace esphome
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace gecko_spa {
+
+// Spa outputs whose run time and energy use are accumulated
+enum class MeteredDevice : uint8_t {
+  HEATER = 0,
+  CIRCULATION,
+  BLOWER,
+  PUMP1,  // Either speed counts as running
+  PUMP2,
+  PUMP3,
+  PUMP4,
+  COUNT
+};
+
+// Totals since the meter was first started, kept in flash
+struct MeterTotals {
+  uint8_t version;  // EnergyMeter::VERSION, bumped whenever the layout changes
+  uint64_t runtime_ms[(size_t) MeteredDevice::COUNT];
+  uint64_t energy_mj[(size_t) MeteredDevice::COUNT];  // Millijoules, watts x ms
+};
+
+// Run time and energy per device, integrated over the time between status messages:
+// each interval counts for the devices that were on in the message that started it.
+// Energy is the configured power times the run time, added as the time is counted, so
+// a power change only applies from then on and the totals never go down.
+struct EnergyMeter {
+  static const uint8_t VERSION{1};
+  // Longer gaps (lost connection) are not counted, the device states are unknown
+  static const uint32_t MAX_GAP_MS{60000};
+
+  MeterTotals totals{VERSION, {}, {}};
+  uint16_t power_w[(size_t) MeteredDevice::COUNT]{};
+  uint32_t last_time{0};
+  bool timing{false};  // last_time is the time of a status message
+
+  // Status message received at now; on: device states of the previous message.
+  // Returns true if any total grew.
+  bool update(uint32_t now, const bool *on) {
+    uint32_t elapsed = now - last_time;
+    bool counted = timing && elapsed <= MAX_GAP_MS;
+    last_time = now;
+    timing = true;
+    if (!counted)
+      return false;
+    bool grew = false;
+    for (size_t i = 0; i < (size_t) MeteredDevice::COUNT; i++) {
+      if (!on[i] || elapsed == 0)
+        continue;
+      totals.runtime_ms[i] += elapsed;
+      totals.energy_mj[i] += (uint64_t) power_w[i] * elapsed;
+      grew = true;
+    }
+    return grew;
+  }
+  // Don't count the time up to the next status message
+  void restart() { timing = false; }
+
+  float runtime_hours(MeteredDevice device) const { return totals.runtime_ms[(size_t) device] / 3.6e6f; }
+  float energy_kwh(MeteredDevice device) const { return totals.energy_mj[(size_t) device] / 3.6e9; }
+  float total_energy_kwh() const {
+    uint64_t total = 0;
+    for (uint64_t mj : totals.energy_mj)
+      total += mj;
+    return total / 3.6e9;
+  }
+};
+
+}  // namespace gecko_spa
+}  // namespace esphome
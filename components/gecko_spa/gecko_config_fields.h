@@ -0,0 +1,443 @@
+// Generated by utils/gen_field_tables.py from utils/config/inyt-cfg-65.py - do not edit.
+#pragma once
+
+#include "gecko_fields.h"
+
+namespace esphome {
+namespace gecko_spa {
+
+enum class ConfigField : uint8_t {
+  ConfigNumber,
+  SetpointG,
+  FiltFreq,
+  FiltStart,
+  FiltDur,
+  EconStart,
+  EconDur,
+  Out1,
+  Out2,
+  Out3,
+  Out4,
+  Out5,
+  Out6,
+  Out7,
+  Out8,
+  Out9,
+  Out10,
+  Out11,
+  Out12,
+  Direct,
+  Direct2,
+  OutHtr,
+  CpUsage,
+  O3Usage,
+  O3Pump,
+  O3Type,
+  HeaterPump,
+  FiltInterface,
+  TempUnits,
+  TimeFormat,
+  CooldownTime,
+  Out1Cur,
+  Out2Cur,
+  Out3Cur,
+  Out4Cur,
+  Out5Cur,
+  Out6Cur,
+  Out7Cur,
+  Out8Cur,
+  Out9Cur,
+  Out10Cur,
+  Out11Cur,
+  Out12Cur,
+  DirectCur,
+  Direct2Cur,
+  OutHtRCur,
+  UL_CE,
+  NbPhases,
+  InputCurrent,
+  PumpTimeOut,
+  LightTimeOut,
+  L120TimeOut,
+  OtOption,
+  OTTriggerG,
+  CpOnTimeDuringOT,
+  CpOffTimeDuringOT,
+  FiltOnTimeDuringOT,
+  FiltSuspendTime,
+  O3SuspendTime,
+  AmbiantOHTrigADC,
+  MinSetpointG,
+  MaxSetpointG,
+  EconType,
+  EconProgAvailable,
+  SoakOnCustomKey,
+  OffOnCustomKey,
+  EconControlableManually,
+  CleanupOnCustomKey,
+  AuxOnCustomKey,
+  QuickOnOffCustomKey,
+  MasterSlave,
+  InputMenu,
+  SlaveConfig,
+  MultiKeyOption,
+  NoHeatPeriod,
+  DrainMode,
+  OutLi,
+  LightInts,
+  L120Timer,
+  Pump1UserAccess,
+  PurgeSpeed,
+  ProbeLocation,
+  SelfCleanMsg,
+  BlowerKeyOption,
+  HeaterSoftStart,
+  HeaterSoftStop,
+  UDProgEcon,
+  Out1Fuse,
+  Out2Fuse,
+  Out3Fuse,
+  Out4Fuse,
+  Out5Fuse,
+  Out6Fuse,
+  Out7Fuse,
+  Out8Fuse,
+  Out9Fuse,
+  Out10Fuse,
+  Out11Fuse,
+  Out12Fuse,
+  Direct1Fuse,
+  Direct2Fuse,
+  OutHtrFuse,
+  F1Current,
+  F2Current,
+  F3Current,
+  F21Current,
+  F22Current,
+  F23Current,
+  F1Line,
+  F2Line,
+  F3Line,
+  F21Line,
+  F22Line,
+  F23Line,
+  KeypadTherapySupport,
+  CustomKeyEnabled,
+  ConfigChange,
+  BreakerChange,
+  KeypadBacklightColor,
+  KeypadBacklightEdit,
+  CustomerID,
+  ModeKeyAsInvertDisplayKey,
+  InfoMsgConfig,
+  LowerSetpointMenu,
+  SinglePumpKey,
+  KeypadOptions4,
+  MaxNumberOfPhases,
+  CoolZoneMode,
+  FiltDur2,
+  WaterfallTimeOut,
+  DealerLockSupport,
+  AuxAsBubbleGen,
+  WaterfallAsCP,
+  SuspendSilentToRegulate,
+  WaterfallValveOnCP,
+  AuxTimeOut,
+  LockEnabled,
+  MinimumInputCurrent,
+  Zone1Led,
+  Zone1Type,
+  MapZone1ToOut1,
+  MapZone1ToOut2,
+  MapZone1ToOut3,
+  MapZone1ToOut4,
+  Zone2Led,
+  Zone2Type,
+  MapZone2ToOut1,
+  MapZone2ToOut2,
+  MapZone2ToOut3,
+  MapZone2ToOut4,
+  Zone3Led,
+  Zone3Type,
+  MapZone3ToOut1,
+  MapZone3ToOut2,
+  MapZone3ToOut3,
+  MapZone3ToOut4,
+  Zone4Led,
+  Zone4Type,
+  MapZone4ToOut1,
+  MapZone4ToOut2,
+  MapZone4ToOut3,
+  MapZone4ToOut4,
+  NumberOfZones,
+  MappingEnable,
+  ProgOutStart,
+  ProgOutDur,
+  ProgOutFreq,
+  ExerciseType,
+  ExerciseControl,
+  ExercisePumpsUsed,
+  ExerciseDedicatedPumps,
+  ExerciseNumberOfIntensity,
+  ExercisePumpCombination1,
+  ExercisePumpCombination2,
+  ExercisePumpCombination3,
+  ExercisePumpCombination4,
+  ExercisePumpCombination5,
+  ExercisePumpCombination6,
+  ExercisePumpCombination7,
+  ExercisePumpCombination8,
+  ExercisePumpCombination9,
+  ExercisePumpCombination10,
+  SilentMode,
+  SilentDuration,
+  ProgOutAccessory,
+  HeatPumpCurrent,
+  GenericHeatPumpID,
+  HeatPumpFuse,
+  COUNT
+};
+
+static constexpr const char *CONFIG_VALUES_0[] = {"NA", "P1H", "P1L", "P2H", "P2L", "P3H", "P3L", "P4H", "P4L", "P5", "BLO", "CP", "O3", "L120", "HTR", "", "Fan", "", "", "FullOn", "", "", "", "ONZEN", "", "HTR2", "Waterfall", "AUX"};
+static constexpr const char *CONFIG_VALUES_1[] = {"NA", "", "", "", "", "", "", "", "", "", "", "CP"};
+static constexpr const char *CONFIG_VALUES_2[] = {"NA", "", "", "", "", "", "", "", "", "", "", "", "", "", "HTR", "", "", "", "", "", "", "", "", "", "", "HTR2"};
+static constexpr const char *CONFIG_VALUES_3[] = {"STANDARD", "ALWAYS_ON"};
+static constexpr const char *CONFIG_VALUES_4[] = {"Filter", "Always"};
+static constexpr const char *CONFIG_VALUES_5[] = {"CP", "P1"};
+static constexpr const char *CONFIG_VALUES_6[] = {"Standard", "Toggle"};
+static constexpr const char *CONFIG_VALUES_7[] = {"PurgeOnly", "FiltCP", "FiltP1", "FiltP1DurOnly"};
+static constexpr const char *CONFIG_VALUES_8[] = {"F", "C"};
+static constexpr const char *CONFIG_VALUES_9[] = {"NA", "AmPm", "24h"};
+static constexpr const char *CONFIG_VALUES_10[] = {"UL", "CE"};
+static constexpr const char *CONFIG_VALUES_11[] = {"Disabled", "AlwaysEnabled", "WithSPOver95F"};
+static constexpr const char *CONFIG_VALUES_12[] = {"Standard", "Night"};
+static constexpr const char *CONFIG_VALUES_13[] = {"NA", "STANDARD", "OUTSIDE_FILTER"};
+static constexpr const char *CONFIG_VALUES_14[] = {"", "Master", "Slave"};
+static constexpr const char *CONFIG_VALUES_15[] = {"Standard", "DualPack"};
+static constexpr const char *CONFIG_VALUES_16[] = {"NoBlowerOnI2C", "BlowerOnI2C"};
+static constexpr const char *CONFIG_VALUES_17[] = {"NA", "P1", "CP"};
+static constexpr const char *CONFIG_VALUES_18[] = {"", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "LI"};
+static constexpr const char *CONFIG_VALUES_19[] = {"Shared", "Own"};
+static constexpr const char *CONFIG_VALUES_20[] = {"BothSpeeds", "HighSpeedOnly"};
+static constexpr const char *CONFIG_VALUES_21[] = {"Lo", "Hi"};
+static constexpr const char *CONFIG_VALUES_22[] = {"IntoPiping", "IntoTub"};
+static constexpr const char *CONFIG_VALUES_23[] = {"FreePumpKey", "LastPumpKey"};
+static constexpr const char *CONFIG_VALUES_24[] = {"F1", "F2", "F3", "F21", "F22", "F23", "Line1", "Line2", "Line3"};
+static constexpr const char *CONFIG_VALUES_25[] = {"", "", "", "", "", "", "Line1", "Line2", "Line3"};
+static constexpr const char *CONFIG_VALUES_26[] = {"NO_RESTRICTION", "PASSWORD_PROTECTED"};
+static constexpr const char *CONFIG_VALUES_27[] = {"OFF", "RED", "GREEN", "YELLOW", "BLUE", "MAGENTA", "CYAN", "WHITE"};
+static constexpr const char *CONFIG_VALUES_28[] = {"Disable", "Enable"};
+static constexpr const char *CONFIG_VALUES_29[] = {"Generic", "Hydropool", "EndlessPools", "Wellis", "Alps", "Artesian", "Arctic", "Barefoot", "Beachcomber", "Bellagio", "Leisure_Prod_Ind", "Bullfrog", "Coast", "Dimension_one", "Dynasty", "Four_Wind", "Hotspring", "Jacuzzi", "Jazzi", "LA", "Pro_Float", "MAAX", "Marquis", "PDC", "Premium_Leisure", "Strong", "Sunrans", "Sunrise", "SuperiorSpas", "Spa_Industries", "Viking", "WWO_Whirlcare", "Okeanos", "Clearwater", "Deluxe", "Idol", "Aspen", "ThermoSpas", "Titan_Spas", "IberSpa", "Master_Spas"};
+static constexpr const char *CONFIG_VALUES_30[] = {"HIDE_DETAILED_MSG", "SHOW_ALL_MSG", "", ""};
+static constexpr const char *CONFIG_VALUES_31[] = {"NA", "ForSpeeds", "ForZones", ""};
+static constexpr const char *CONFIG_VALUES_32[] = {"CHILL", "HEAT_W_BOOST", "HEAT_SAVER", "AUTO_W_BOOST", "AUTO_SAVER", "INTERNAL_HEAT", "BOTH_HEAT"};
+static constexpr const char *CONFIG_VALUES_33[] = {"NOT_ALLOWED", "ALLOWED"};
+static constexpr const char *CONFIG_VALUES_34[] = {"RGB", "WHITE"};
+static constexpr const char *CONFIG_VALUES_35[] = {"NORMAL", "STATUS"};
+static constexpr const char *CONFIG_VALUES_36[] = {"", "1", "2", "3", "4"};
+static constexpr const char *CONFIG_VALUES_37[] = {"NO_EXERCISE", "SWIM_EXERCISE"};
+static constexpr const char *CONFIG_VALUES_38[] = {"USE_STANDARD_PUMPS"};
+static constexpr const char *CONFIG_VALUES_39[] = {"NO_PUMP", "ALL_PUMPS", "P2_TO_P5", "P3_TO_P5", "P4_AND_P5", "P5_ONLY", "", ""};
+static constexpr const char *CONFIG_VALUES_40[] = {"NA", "OFF", "ECONOMY", "SLEEP", "NIGHT"};
+static constexpr const char *CONFIG_VALUES_41[] = {"NA", "", "", "", "", "", "", "", "", "", "", "", "", "L120", "", "", "", "", "", "", "", "", "", "ONZEN", "", "", "", "AUX"};
+static constexpr const char *CONFIG_VALUES_42[] = {"Not_Set", "0A", "1A", "2A", "3A", "4A", "5A", "6A", "7A", "8A", "9A", "10A", "11A", "12A", "13A", "14A", "15A"};
+
+// Bytes of the config section covered by the fields
+static const uint16_t CONFIG_STRUCT_LEN = 167;
+
+// inyt-cfg-65: positions are message bytes from the start of the config section
+static constexpr FieldDesc CONFIG_FIELDS_V65[] = {
+    {"ConfigNumber", nullptr, 0, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SetpointG", nullptr, 1, FieldType::TEMP, 0, 0xFF, 0, true},
+    {"FiltFreq", nullptr, 3, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"FiltStart", nullptr, 4, FieldType::TIME, 0, 0xFF, 0, true},
+    {"FiltDur", nullptr, 6, FieldType::TIME, 0, 0xFF, 0, true},
+    {"EconStart", nullptr, 8, FieldType::TIME, 0, 0xFF, 0, true},
+    {"EconDur", nullptr, 10, FieldType::TIME, 0, 0xFF, 0, true},
+    {"Out1", CONFIG_VALUES_0, 12, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"Out2", CONFIG_VALUES_0, 13, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"Out3", CONFIG_VALUES_0, 14, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"Out4", CONFIG_VALUES_0, 15, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"Out5", CONFIG_VALUES_0, 16, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"Out6", CONFIG_VALUES_0, 17, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"Out7", CONFIG_VALUES_0, 18, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"Out8", CONFIG_VALUES_0, 19, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"Out9", CONFIG_VALUES_0, 20, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"Out10", CONFIG_VALUES_0, 21, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"Out11", CONFIG_VALUES_0, 22, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"Out12", CONFIG_VALUES_0, 23, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"Direct", CONFIG_VALUES_1, 24, FieldType::ENUM, 0, 0xFF, 12, true},
+    {"Direct2", CONFIG_VALUES_1, 25, FieldType::ENUM, 0, 0xFF, 12, true},
+    {"OutHtr", CONFIG_VALUES_2, 26, FieldType::ENUM, 0, 0xFF, 26, true},
+    {"CpUsage", CONFIG_VALUES_3, 27, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"O3Usage", CONFIG_VALUES_4, 28, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"O3Pump", CONFIG_VALUES_5, 29, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"O3Type", CONFIG_VALUES_6, 30, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"HeaterPump", CONFIG_VALUES_5, 31, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"FiltInterface", CONFIG_VALUES_7, 32, FieldType::ENUM, 0, 0xFF, 4, true},
+    {"TempUnits", CONFIG_VALUES_8, 33, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"TimeFormat", CONFIG_VALUES_9, 34, FieldType::ENUM, 0, 0xFF, 3, true},
+    {"CooldownTime", nullptr, 35, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Out1Cur", nullptr, 36, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Out2Cur", nullptr, 37, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Out3Cur", nullptr, 38, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Out4Cur", nullptr, 39, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Out5Cur", nullptr, 40, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Out6Cur", nullptr, 41, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Out7Cur", nullptr, 42, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Out8Cur", nullptr, 43, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Out9Cur", nullptr, 44, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Out10Cur", nullptr, 45, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Out11Cur", nullptr, 46, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Out12Cur", nullptr, 47, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"DirectCur", nullptr, 48, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Direct2Cur", nullptr, 49, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"OutHtRCur", nullptr, 50, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"UL_CE", CONFIG_VALUES_10, 51, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"NbPhases", nullptr, 52, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"InputCurrent", nullptr, 53, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"PumpTimeOut", nullptr, 54, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"LightTimeOut", nullptr, 55, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"L120TimeOut", nullptr, 56, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"OtOption", CONFIG_VALUES_11, 57, FieldType::ENUM, 0, 0xFF, 3, true},
+    {"OTTriggerG", nullptr, 58, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"CpOnTimeDuringOT", nullptr, 59, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"CpOffTimeDuringOT", nullptr, 60, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"FiltOnTimeDuringOT", nullptr, 64, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"FiltSuspendTime", nullptr, 65, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"O3SuspendTime", nullptr, 66, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"AmbiantOHTrigADC", nullptr, 67, FieldType::WORD, 0, 0xFF, 0, true},
+    {"MinSetpointG", nullptr, 69, FieldType::TEMP, 0, 0xFF, 0, true},
+    {"MaxSetpointG", nullptr, 71, FieldType::TEMP, 0, 0xFF, 0, true},
+    {"EconType", CONFIG_VALUES_12, 73, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"EconProgAvailable", CONFIG_VALUES_13, 74, FieldType::ENUM, 0, 0xFF, 3, true},
+    {"SoakOnCustomKey", nullptr, 75, FieldType::BOOL, 0, 0x01, 0, true},
+    {"OffOnCustomKey", nullptr, 75, FieldType::BOOL, 1, 0x01, 0, true},
+    {"EconControlableManually", nullptr, 75, FieldType::BOOL, 2, 0x01, 0, true},
+    {"CleanupOnCustomKey", nullptr, 75, FieldType::BOOL, 3, 0x01, 0, true},
+    {"AuxOnCustomKey", nullptr, 75, FieldType::BOOL, 4, 0x01, 0, true},
+    {"QuickOnOffCustomKey", nullptr, 75, FieldType::BOOL, 5, 0x01, 0, true},
+    {"MasterSlave", CONFIG_VALUES_14, 76, FieldType::ENUM, 0, 0xFF, 3, true},
+    {"InputMenu", CONFIG_VALUES_15, 77, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"SlaveConfig", nullptr, 78, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"MultiKeyOption", CONFIG_VALUES_16, 79, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"NoHeatPeriod", nullptr, 80, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"DrainMode", CONFIG_VALUES_17, 81, FieldType::ENUM, 0, 0xFF, 3, true},
+    {"OutLi", CONFIG_VALUES_18, 82, FieldType::ENUM, 0, 0xFF, 16, false},
+    {"LightInts", nullptr, 83, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"L120Timer", CONFIG_VALUES_19, 84, FieldType::ENUM, 0, 0x01, 2, true},
+    {"Pump1UserAccess", CONFIG_VALUES_20, 84, FieldType::ENUM, 1, 0x01, 2, true},
+    {"PurgeSpeed", CONFIG_VALUES_21, 84, FieldType::ENUM, 2, 0x01, 2, true},
+    {"ProbeLocation", CONFIG_VALUES_22, 84, FieldType::ENUM, 3, 0x01, 2, true},
+    {"SelfCleanMsg", nullptr, 84, FieldType::BOOL, 4, 0x01, 0, true},
+    {"BlowerKeyOption", CONFIG_VALUES_23, 84, FieldType::ENUM, 5, 0x01, 2, true},
+    {"HeaterSoftStart", nullptr, 84, FieldType::BOOL, 6, 0x01, 0, true},
+    {"HeaterSoftStop", nullptr, 84, FieldType::BOOL, 7, 0x01, 0, true},
+    {"UDProgEcon", nullptr, 85, FieldType::BOOL, 0, 0x01, 0, true},
+    {"Out1Fuse", CONFIG_VALUES_24, 86, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Out2Fuse", CONFIG_VALUES_24, 87, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Out3Fuse", CONFIG_VALUES_24, 88, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Out4Fuse", CONFIG_VALUES_24, 89, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Out5Fuse", CONFIG_VALUES_24, 90, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Out6Fuse", CONFIG_VALUES_24, 91, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Out7Fuse", CONFIG_VALUES_24, 92, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Out8Fuse", CONFIG_VALUES_24, 93, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Out9Fuse", CONFIG_VALUES_24, 94, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Out10Fuse", CONFIG_VALUES_24, 95, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Out11Fuse", CONFIG_VALUES_24, 96, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Out12Fuse", CONFIG_VALUES_24, 97, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Direct1Fuse", CONFIG_VALUES_24, 98, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"Direct2Fuse", CONFIG_VALUES_24, 99, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"OutHtrFuse", CONFIG_VALUES_24, 100, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"F1Current", nullptr, 101, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"F2Current", nullptr, 102, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"F3Current", nullptr, 103, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"F21Current", nullptr, 104, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"F22Current", nullptr, 105, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"F23Current", nullptr, 106, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"F1Line", CONFIG_VALUES_25, 107, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"F2Line", CONFIG_VALUES_25, 108, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"F3Line", CONFIG_VALUES_25, 109, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"F21Line", CONFIG_VALUES_25, 110, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"F22Line", CONFIG_VALUES_25, 111, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"F23Line", CONFIG_VALUES_25, 112, FieldType::ENUM, 0, 0xFF, 9, true},
+    {"KeypadTherapySupport", nullptr, 113, FieldType::BOOL, 0, 0x01, 0, true},
+    {"CustomKeyEnabled", nullptr, 113, FieldType::BOOL, 1, 0x01, 0, true},
+    {"ConfigChange", CONFIG_VALUES_26, 113, FieldType::ENUM, 2, 0x01, 2, true},
+    {"BreakerChange", CONFIG_VALUES_26, 113, FieldType::ENUM, 3, 0x01, 2, true},
+    {"KeypadBacklightColor", CONFIG_VALUES_27, 113, FieldType::ENUM, 4, 0x07, 8, true},
+    {"KeypadBacklightEdit", CONFIG_VALUES_28, 113, FieldType::ENUM, 7, 0x01, 2, true},
+    {"CustomerID", CONFIG_VALUES_29, 114, FieldType::ENUM, 0, 0xFF, 41, true},
+    {"ModeKeyAsInvertDisplayKey", nullptr, 115, FieldType::BOOL, 1, 0x01, 0, true},
+    {"InfoMsgConfig", CONFIG_VALUES_30, 115, FieldType::ENUM, 2, 0x03, 4, true},
+    {"LowerSetpointMenu", nullptr, 115, FieldType::BOOL, 4, 0x01, 0, true},
+    {"SinglePumpKey", CONFIG_VALUES_31, 115, FieldType::ENUM, 6, 0x03, 4, true},
+    {"KeypadOptions4", nullptr, 116, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"MaxNumberOfPhases", nullptr, 117, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"CoolZoneMode", CONFIG_VALUES_32, 118, FieldType::ENUM, 0, 0xFF, 7, true},
+    {"FiltDur2", nullptr, 119, FieldType::TIME, 0, 0xFF, 0, true},
+    {"WaterfallTimeOut", nullptr, 121, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"DealerLockSupport", nullptr, 122, FieldType::BOOL, 0, 0x01, 0, true},
+    {"AuxAsBubbleGen", nullptr, 122, FieldType::BOOL, 1, 0x01, 0, true},
+    {"WaterfallAsCP", nullptr, 122, FieldType::BOOL, 2, 0x01, 0, true},
+    {"SuspendSilentToRegulate", CONFIG_VALUES_33, 122, FieldType::ENUM, 3, 0x01, 2, true},
+    {"WaterfallValveOnCP", nullptr, 122, FieldType::BOOL, 4, 0x01, 0, true},
+    {"AuxTimeOut", nullptr, 123, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"LockEnabled", nullptr, 124, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"MinimumInputCurrent", nullptr, 125, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Zone1Led", CONFIG_VALUES_34, 126, FieldType::ENUM, 0, 0x01, 2, false},
+    {"Zone1Type", CONFIG_VALUES_35, 126, FieldType::ENUM, 1, 0x01, 2, false},
+    {"MapZone1ToOut1", nullptr, 126, FieldType::BOOL, 4, 0x01, 0, false},
+    {"MapZone1ToOut2", nullptr, 126, FieldType::BOOL, 5, 0x01, 0, false},
+    {"MapZone1ToOut3", nullptr, 126, FieldType::BOOL, 6, 0x01, 0, false},
+    {"MapZone1ToOut4", nullptr, 126, FieldType::BOOL, 7, 0x01, 0, false},
+    {"Zone2Led", CONFIG_VALUES_34, 127, FieldType::ENUM, 0, 0x01, 2, false},
+    {"Zone2Type", CONFIG_VALUES_35, 127, FieldType::ENUM, 1, 0x01, 2, false},
+    {"MapZone2ToOut1", nullptr, 127, FieldType::BOOL, 4, 0x01, 0, false},
+    {"MapZone2ToOut2", nullptr, 127, FieldType::BOOL, 5, 0x01, 0, false},
+    {"MapZone2ToOut3", nullptr, 127, FieldType::BOOL, 6, 0x01, 0, false},
+    {"MapZone2ToOut4", nullptr, 127, FieldType::BOOL, 7, 0x01, 0, false},
+    {"Zone3Led", CONFIG_VALUES_34, 128, FieldType::ENUM, 0, 0x01, 2, false},
+    {"Zone3Type", CONFIG_VALUES_35, 128, FieldType::ENUM, 1, 0x01, 2, false},
+    {"MapZone3ToOut1", nullptr, 128, FieldType::BOOL, 4, 0x01, 0, false},
+    {"MapZone3ToOut2", nullptr, 128, FieldType::BOOL, 5, 0x01, 0, false},
+    {"MapZone3ToOut3", nullptr, 128, FieldType::BOOL, 6, 0x01, 0, false},
+    {"MapZone3ToOut4", nullptr, 128, FieldType::BOOL, 7, 0x01, 0, false},
+    {"Zone4Led", CONFIG_VALUES_34, 129, FieldType::ENUM, 0, 0x01, 2, false},
+    {"Zone4Type", CONFIG_VALUES_35, 129, FieldType::ENUM, 1, 0x01, 2, false},
+    {"MapZone4ToOut1", nullptr, 129, FieldType::BOOL, 4, 0x01, 0, false},
+    {"MapZone4ToOut2", nullptr, 129, FieldType::BOOL, 5, 0x01, 0, false},
+    {"MapZone4ToOut3", nullptr, 129, FieldType::BOOL, 6, 0x01, 0, false},
+    {"MapZone4ToOut4", nullptr, 129, FieldType::BOOL, 7, 0x01, 0, false},
+    {"NumberOfZones", CONFIG_VALUES_36, 130, FieldType::ENUM, 0, 0x07, 5, false},
+    {"MappingEnable", nullptr, 130, FieldType::BOOL, 7, 0x01, 0, false},
+    {"ProgOutStart", nullptr, 131, FieldType::TIME, 0, 0xFF, 0, true},
+    {"ProgOutDur", nullptr, 133, FieldType::TIME, 0, 0xFF, 0, true},
+    {"ProgOutFreq", nullptr, 135, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"ExerciseType", CONFIG_VALUES_37, 136, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"ExerciseControl", CONFIG_VALUES_38, 137, FieldType::ENUM, 0, 0xFF, 1, true},
+    {"ExercisePumpsUsed", CONFIG_VALUES_39, 138, FieldType::ENUM, 0, 0x07, 8, true},
+    {"ExerciseDedicatedPumps", nullptr, 138, FieldType::BOOL, 7, 0x01, 0, true},
+    {"ExerciseNumberOfIntensity", nullptr, 139, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"ExercisePumpCombination1", nullptr, 140, FieldType::WORD, 0, 0xFF, 0, true},
+    {"ExercisePumpCombination2", nullptr, 142, FieldType::WORD, 0, 0xFF, 0, true},
+    {"ExercisePumpCombination3", nullptr, 144, FieldType::WORD, 0, 0xFF, 0, true},
+    {"ExercisePumpCombination4", nullptr, 146, FieldType::WORD, 0, 0xFF, 0, true},
+    {"ExercisePumpCombination5", nullptr, 148, FieldType::WORD, 0, 0xFF, 0, true},
+    {"ExercisePumpCombination6", nullptr, 150, FieldType::WORD, 0, 0xFF, 0, true},
+    {"ExercisePumpCombination7", nullptr, 152, FieldType::WORD, 0, 0xFF, 0, true},
+    {"ExercisePumpCombination8", nullptr, 154, FieldType::WORD, 0, 0xFF, 0, true},
+    {"ExercisePumpCombination9", nullptr, 156, FieldType::WORD, 0, 0xFF, 0, true},
+    {"ExercisePumpCombination10", nullptr, 158, FieldType::WORD, 0, 0xFF, 0, true},
+    {"SilentMode", CONFIG_VALUES_40, 160, FieldType::ENUM, 0, 0xFF, 5, true},
+    {"SilentDuration", nullptr, 161, FieldType::TIME, 0, 0xFF, 0, true},
+    {"ProgOutAccessory", CONFIG_VALUES_41, 163, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"HeatPumpCurrent", CONFIG_VALUES_42, 164, FieldType::ENUM, 0, 0xFF, 17, false},
+    {"GenericHeatPumpID", nullptr, 165, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"HeatPumpFuse", CONFIG_VALUES_24, 166, FieldType::ENUM, 0, 0xFF, 9, false},
+};
+
+static_assert(sizeof(CONFIG_FIELDS_V65) / sizeof(FieldDesc) == (size_t) ConfigField::COUNT, "CONFIG_FIELDS_V65 size");
+
+}  // namespace gecko_spa
+}  // namespace esphome
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace gecko_spa {
+
+// Field descriptors generated from the geckolib struct definitions
+// (see utils/gen_field_tables.py). Positions are geckolib offsets.
+enum class FieldType : uint8_t {
+  NONE = 0,  // Not present in this struct version
+  BOOL,      // Single bit
+  BYTE,
+  ENUM,      // Byte, optionally shifted and masked, indexing a value list
+  WORD,      // Big-endian word (types from here on are two bytes wide)
+  TEMP,      // Word in 1/18 degC
+  TIME,      // Hours byte followed by minutes byte
+};
+
+struct FieldDesc {
+  const char *name;
+  const char *const *values;  // ENUM value names, nullptr otherwise
+  uint16_t pos;
+  FieldType type;
+  uint8_t shift;
+  uint8_t mask;
+  uint8_t num_values;
+  bool writable;
+};
+
+// Status (log) struct: message byte = geckolib offset - 254
+static const uint16_t LOG_MSG_BASE = 254;
+
+// Decoded value of a field that is missing from the struct version or message
+static const int32_t FIELD_UNAVAILABLE = -1;
+
+inline uint8_t field_width(const FieldDesc &f) { return f.type >= FieldType::WORD ? 2 : 1; }
+
+inline int32_t decode_field(const FieldDesc &f, const uint8_t *data, uint16_t len, uint16_t base) {
+  if (f.type == FieldType::NONE || f.pos < base || f.pos - base + field_width(f) > len)
+    return FIELD_UNAVAILABLE;
+  const uint8_t *p = data + (f.pos - base);
+  if (f.type >= FieldType::WORD)
+    return (p[0] << 8) | p[1];
+  return (p[0] >> f.shift) & f.mask;
+}
+
+// Decode every field of a table into out[0..count-1]
+inline void decode_fields(const FieldDesc *table, size_t count, const uint8_t *data, uint16_t len,
+                          uint16_t base, int32_t *out) {
+  for (size_t i = 0; i < count; i++)
+    out[i] = decode_field(table[i], data, len, base);
+}
+
+// Name of an ENUM value, or "?" when out of range
+inline const char *field_value_name(const FieldDesc &f, int32_t value) {
+  if (f.values == nullptr || value < 0 || value >= f.num_values)
+    return "?";
+  return f.values[value];
+}
+
+}  // namespace gecko_spa
+}  // namespace esphome
@@ -0,0 +1,22 @@
+// Generated by utils/gen_field_tables.py - do not edit.
+#pragma once
+
+#include "gecko_config_fields.h"
+#include "gecko_log_fields.h"
+#include "message_layout.h"
+
+namespace esphome {
+namespace gecko_spa {
+
+static constexpr MessageLayout MESSAGE_LAYOUTS[] = {
+    {"inYT", 'C', 0, 255, CONFIG_FIELDS_V65, 0, CFG_OFFSET, CONFIG_STRUCT_LEN},
+    {"inYT", 'S', 65, 65, LOG_FIELDS_V65, LOG_MSG_BASE, 0, 162},
+    {"inYT", 'S', 51, 255, LOG_FIELDS_V65, LOG_MSG_BASE, 0, 0},
+    {"inYT", 'S', 0, 50, LOG_FIELDS_V50, LOG_MSG_BASE, 0, 0},
+};
+
+static constexpr const MessageLayout *DEFAULT_CONFIG_LAYOUT = &MESSAGE_LAYOUTS[0];
+static constexpr const MessageLayout *DEFAULT_STATUS_LAYOUT = &MESSAGE_LAYOUTS[1];
+
+}  // namespace gecko_spa
+}  // namespace esphome
@@ -0,0 +1,609 @@
+// Generated by utils/gen_field_tables.py from utils/config/inyt-log-65.py - do not edit.
+#pragma once
+
+#include "gecko_fields.h"
+
+namespace esphome {
+namespace gecko_spa {
+
+enum class LogField : uint8_t {
+  Hours,
+  QuietState,
+  UdP5,
+  UdBL,
+  UdP1,
+  UdP2,
+  UdP3,
+  UdP4,
+  P5,
+  BL,
+  CP,
+  O3,
+  L120,
+  Heating,
+  MSTR_HEATER,
+  SLV_HEATER,
+  Waterfall,
+  P1,
+  P2,
+  P3,
+  P4,
+  FilterAccess,
+  ProgOutputAccess,
+  EconomyAccess,
+  RemoteFiltAction,
+  RemoteFiltDur,
+  RemoteFiltDurPerDay,
+  RemoteEconAction,
+  RemoteEconDur,
+  RemoteConfigIndex,
+  RemoteNbOfPhases,
+  RemoteBreakerIndex,
+  Clean,
+  Purge,
+  FiltSuspendByUD,
+  FiltSuspendedByOT,
+  FiltSuspendedByErr,
+  OverTemp,
+  CPOT,
+  ThermFuseErr,
+  inFloPressureSwDetected,
+  StickDetected,
+  RealSetPointG,
+  DisplayedTempG,
+  TempNotValid,
+  ExtProbeDetected,
+  RhFloDetected,
+  CheckFlo,
+  ProgEconActive,
+  EconActive,
+  ThermistanceErr,
+  AmbiantOHLevel2,
+  SwmPurgeSusp,
+  SwmPurge,
+  SwmActive,
+  RhHwHL,
+  RhRegProbeErr,
+  KinPumpOff,
+  RegOverHeat,
+  RhRegSlope,
+  HtrSuspendByPwrMng,
+  Htr2SuspendByPwrMng,
+  P1HStuck,
+  P2HStuck,
+  HeaterStuck,
+  RelayStuck,
+  PackBootID,
+  PackBootRev,
+  PackBootRel,
+  PackType,
+  PackMemRange,
+  PackRegion,
+  PackCoreID,
+  PackCoreRev,
+  PackCoreRel,
+  PackConfigLib,
+  PackStatusLib,
+  PackConfID,
+  PackConfRev,
+  PackConfRel,
+  PackNumberOfConf,
+  UdPumpTime,
+  UdQuietTime,
+  UdLightTime,
+  UdL120Time,
+  UdLi,
+  UdL120,
+  RhHrKinNoFlo,
+  RhNoFloXTries,
+  FLCErr,
+  LockMode,
+  inTCipDelay,
+  SwmRisk,
+  SlaveFloDetected,
+  SlaveKinNoFloErr,
+  SlaveNoFloErr,
+  PackLogTrig,
+  RhWaterTemp,
+  Menu,
+  SOut1,
+  SOut2,
+  SOut3,
+  SOut4,
+  SOut5,
+  SOut6,
+  SOut7,
+  SOutHtr,
+  SOut1Cur,
+  SOut8,
+  SOut2Cur,
+  SOut9,
+  SOut10,
+  SOut3Cur,
+  SOut11,
+  SOut4Cur,
+  SOut12,
+  SOut5Cur,
+  SDirect,
+  SDirect2,
+  SOutHtrCur,
+  SOut6Cur,
+  SOut7Cur,
+  SOut8Cur,
+  SOut9Cur,
+  SOut10Cur,
+  SOut11Cur,
+  SOut12Cur,
+  SDirectCur,
+  SDirect2Cur,
+  SlaveHtrSuspendByPwrMng,
+  SlaveHtr2SuspendByPwrMng,
+  SlaveP1HStuck,
+  SlaveP2HStuck,
+  SlaveHtrStuck,
+  SlaveRelayStuck,
+  SlaveHLErr,
+  SlaveRegProbeErr,
+  SlaveKinPumpOff,
+  SlaveRegOverHeat,
+  SlaveRegSlope,
+  SlaveOverTemp,
+  SlaveThermFuseErr,
+  SlaveThermistanceErr,
+  SlaveAmbiantOHLevel2,
+  SlaveSwmPurge,
+  SlaveSwmActive,
+  SlaveMissingErr,
+  SwmAdc,
+  KeypadType,
+  KeypadID,
+  KeypadRev,
+  KeypadRel,
+  UdWaterFallTime,
+  UdWaterfall,
+  DealerLockStatus,
+  DealerLockSeed,
+  DealerLockKey,
+  UdAuxTime,
+  UdAux,
+  inFloRatio,
+  inFloRatioMinimum,
+  inFloRatioMaximum,
+  inFloErrorType,
+  ForceCheckFlo,
+  PackReset,
+  inFloJustReset,
+  SideHeatingDegG,
+  CoolZoneDetected,
+  ModbusHeatPumpDetected,
+  HPCResHeaterRequest,
+  HPCHeatRequest,
+  HPCChillRequest,
+  HPCAutoMode,
+  HPCState,
+  RemoteProgOutputAction,
+  RemoteProgOutputDur,
+  SilentModeActive,
+  InGridDetected,
+  ExerciseDetectedType,
+  ExerciseIntensity,
+  ModbusHeatPumpErrorID,
+  ProgOutputRequest,
+  ProgOutputUserOff,
+  ModbusHeatPumpType,
+  ModbusHeatPumpAmbient,
+  COUNT
+};
+
+static constexpr const char *LOG_VALUES_0[] = {"NOT_SET", "DRAIN", "SOAK", "OFF"};
+static constexpr const char *LOG_VALUES_1[] = {"OFF", "HI"};
+static constexpr const char *LOG_VALUES_2[] = {"OFF", "ON"};
+static constexpr const char *LOG_VALUES_3[] = {"OFF", "LO", "HI"};
+static constexpr const char *LOG_VALUES_4[] = {"OFF", "HIGH"};
+static constexpr const char *LOG_VALUES_5[] = {"", "Heating", "Heating", "Heating"};
+static constexpr const char *LOG_VALUES_6[] = {"OFF", "HIGH", "LOW"};
+static constexpr const char *LOG_VALUES_7[] = {"INTERNAL", "REMOTE"};
+static constexpr const char *LOG_VALUES_8[] = {"IDLE", "STOP", "START", "NEW", "ACTIVE"};
+static constexpr const char *LOG_VALUES_9[] = {"Unknown", "inXE", "MasIBC", "MIA", "DJS4", "inClear", "inXM", "K600", "inTerface", "inTouch", "inYT"};
+static constexpr const char *LOG_VALUES_10[] = {"16K", "32K", "48K", "64K"};
+static constexpr const char *LOG_VALUES_11[] = {"UL", "CE"};
+static constexpr const char *LOG_VALUES_12[] = {"", "RhNoFloXTries", "RhNoFloXTries", "RhNoFloXTries"};
+static constexpr const char *LOG_VALUES_13[] = {"UNLOCK", "PARTIAL", "FULL"};
+static constexpr const char *LOG_VALUES_14[] = {"NO", "LO", "MED", "HI", "EXTREME"};
+static constexpr const char *LOG_VALUES_15[] = {"Restricted", "Full"};
+static constexpr const char *LOG_VALUES_16[] = {"NORMAL", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "InstallerOpt", "DealerOpt", "AccessoryOpt", "ConfigSelect", "", "StickBank"};
+static constexpr const char *LOG_VALUES_17[] = {"NA", "P1H", "P1L", "P2H", "P2L", "P3H", "P3L", "P4H", "P4L", "P5", "BLO", "CP", "O3", "L120", "", "", "", "", "", "FullOn", "", "", "", "", "", "", "Waterfall", "AUX"};
+static constexpr const char *LOG_VALUES_18[] = {"NA", "P1H", "P1L", "P2H", "P2L", "P3H", "P3L", "P4H", "P4L", "P5", "BLO", "CP", "O3", "L120", "", "", "Fan", "", "", "FullOn", "", "", "", "", "", "", "Waterfall", "AUX"};
+static constexpr const char *LOG_VALUES_19[] = {"NA", "", "", "", "", "", "", "", "", "", "", "", "", "", "HTR"};
+static constexpr const char *LOG_VALUES_20[] = {"NA", "", "", "", "", "", "", "", "", "", "", "CP"};
+static constexpr const char *LOG_VALUES_21[] = {"K200", "K400", "K85", "K8", "K4", "K5", "K600LE", "K100", "K800", "", "", "", "K600HE", "K300", "INVALID_TYPE"};
+static constexpr const char *LOG_VALUES_22[] = {"FLOW_OK", "MODE_1_FAIL", "MODE_1_AND_2_FAIL", "MODE_1_AND_HEATING_FAIL", "HEATING_FAIL"};
+static constexpr const char *LOG_VALUES_23[] = {"---", "RESET"};
+static constexpr const char *LOG_VALUES_24[] = {"HEAT", "CHILL"};
+static constexpr const char *LOG_VALUES_25[] = {"IDLE", "HEAT_ON", "CHILL_ON", "", "", "", "", "", "", "", "", "", "", "", "", "", "INVALID_REQUEST", "COIL_SENSOR_ERR", "AMBIENT_TEMP_ERR", "EE1_EE2_ERR", "PRESSURE_ERR", "OTHER_ERR"};
+static constexpr const char *LOG_VALUES_26[] = {"NOT_INSTALLED", "SWIM_EXERCISE", "TREADMILL"};
+static constexpr const char *LOG_VALUES_27[] = {"GENERIC", "GECKO_5000W", "GECKO7500W"};
+
+// inyt-log-65: used for status versions > 50
+static constexpr FieldDesc LOG_FIELDS_V65[] = {
+    {"Hours", nullptr, 256, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"QuietState", LOG_VALUES_0, 257, FieldType::ENUM, 0, 0xFF, 4, true},
+    {"UdP5", LOG_VALUES_1, 258, FieldType::ENUM, 0, 0x01, 2, true},
+    {"UdBL", LOG_VALUES_2, 258, FieldType::ENUM, 1, 0x01, 2, true},
+    {"UdP1", LOG_VALUES_3, 259, FieldType::ENUM, 0, 0x03, 3, true},
+    {"UdP2", LOG_VALUES_3, 259, FieldType::ENUM, 2, 0x03, 3, true},
+    {"UdP3", LOG_VALUES_3, 259, FieldType::ENUM, 4, 0x03, 3, true},
+    {"UdP4", LOG_VALUES_3, 259, FieldType::ENUM, 6, 0x03, 3, true},
+    {"P5", LOG_VALUES_4, 260, FieldType::ENUM, 0, 0x01, 2, false},
+    {"BL", LOG_VALUES_2, 260, FieldType::ENUM, 1, 0x01, 2, false},
+    {"CP", LOG_VALUES_2, 260, FieldType::ENUM, 2, 0x01, 2, false},
+    {"O3", LOG_VALUES_2, 260, FieldType::ENUM, 3, 0x01, 2, false},
+    {"L120", LOG_VALUES_2, 260, FieldType::ENUM, 4, 0x01, 2, false},
+    {"Heating", LOG_VALUES_5, 260, FieldType::ENUM, 5, 0x03, 4, false},
+    {"MSTR_HEATER", LOG_VALUES_2, 260, FieldType::ENUM, 5, 0x01, 2, false},
+    {"SLV_HEATER", LOG_VALUES_2, 260, FieldType::ENUM, 6, 0x01, 2, false},
+    {"Waterfall", LOG_VALUES_2, 260, FieldType::ENUM, 7, 0x01, 2, false},
+    {"P1", LOG_VALUES_6, 261, FieldType::ENUM, 0, 0x03, 3, false},
+    {"P2", LOG_VALUES_6, 261, FieldType::ENUM, 2, 0x03, 3, false},
+    {"P3", LOG_VALUES_6, 261, FieldType::ENUM, 4, 0x03, 3, false},
+    {"P4", LOG_VALUES_6, 261, FieldType::ENUM, 6, 0x03, 3, false},
+    {"FilterAccess", LOG_VALUES_7, 262, FieldType::ENUM, 0, 0x01, 2, true},
+    {"ProgOutputAccess", LOG_VALUES_7, 262, FieldType::ENUM, 1, 0x01, 2, true},
+    {"EconomyAccess", LOG_VALUES_7, 262, FieldType::ENUM, 2, 0x01, 2, true},
+    {"RemoteFiltAction", LOG_VALUES_8, 263, FieldType::ENUM, 0, 0xFF, 5, true},
+    {"RemoteFiltDur", nullptr, 264, FieldType::TIME, 0, 0xFF, 0, true},
+    {"RemoteFiltDurPerDay", nullptr, 266, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"RemoteEconAction", LOG_VALUES_8, 267, FieldType::ENUM, 0, 0xFF, 5, true},
+    {"RemoteEconDur", nullptr, 268, FieldType::TIME, 0, 0xFF, 0, true},
+    {"RemoteConfigIndex", nullptr, 270, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"RemoteNbOfPhases", nullptr, 271, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"RemoteBreakerIndex", nullptr, 272, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"Clean", nullptr, 273, FieldType::BOOL, 0, 0x01, 0, false},
+    {"Purge", nullptr, 273, FieldType::BOOL, 2, 0x01, 0, false},
+    {"FiltSuspendByUD", nullptr, 273, FieldType::BOOL, 3, 0x01, 0, false},
+    {"FiltSuspendedByOT", nullptr, 273, FieldType::BOOL, 4, 0x01, 0, false},
+    {"FiltSuspendedByErr", nullptr, 273, FieldType::BOOL, 5, 0x01, 0, false},
+    {"OverTemp", nullptr, 274, FieldType::BOOL, 1, 0x01, 0, false},
+    {"CPOT", nullptr, 274, FieldType::BOOL, 2, 0x01, 0, false},
+    {"ThermFuseErr", nullptr, 274, FieldType::BOOL, 3, 0x01, 0, false},
+    {"inFloPressureSwDetected", nullptr, 274, FieldType::BOOL, 5, 0x01, 0, false},
+    {"StickDetected", nullptr, 274, FieldType::BOOL, 6, 0x01, 0, false},
+    {"RealSetPointG", nullptr, 275, FieldType::TEMP, 0, 0xFF, 0, false},
+    {"DisplayedTempG", nullptr, 277, FieldType::TEMP, 0, 0xFF, 0, false},
+    {"TempNotValid", nullptr, 279, FieldType::BOOL, 2, 0x01, 0, false},
+    {"ExtProbeDetected", nullptr, 279, FieldType::BOOL, 6, 0x01, 0, false},
+    {"RhFloDetected", nullptr, 280, FieldType::BOOL, 0, 0x01, 0, false},
+    {"CheckFlo", nullptr, 280, FieldType::BOOL, 2, 0x01, 0, false},
+    {"ProgEconActive", nullptr, 281, FieldType::BOOL, 1, 0x01, 0, false},
+    {"EconActive", nullptr, 281, FieldType::BOOL, 2, 0x01, 0, true},
+    {"ThermistanceErr", nullptr, 282, FieldType::BOOL, 0, 0x01, 0, false},
+    {"AmbiantOHLevel2", nullptr, 282, FieldType::BOOL, 1, 0x01, 0, false},
+    {"SwmPurgeSusp", nullptr, 282, FieldType::BOOL, 3, 0x01, 0, false},
+    {"SwmPurge", nullptr, 282, FieldType::BOOL, 5, 0x01, 0, false},
+    {"SwmActive", nullptr, 282, FieldType::BOOL, 6, 0x01, 0, false},
+    {"RhHwHL", nullptr, 283, FieldType::BOOL, 0, 0x01, 0, false},
+    {"RhRegProbeErr", nullptr, 283, FieldType::BOOL, 1, 0x01, 0, false},
+    {"KinPumpOff", nullptr, 283, FieldType::BOOL, 2, 0x01, 0, false},
+    {"RegOverHeat", nullptr, 283, FieldType::BOOL, 3, 0x01, 0, false},
+    {"RhRegSlope", nullptr, 283, FieldType::BOOL, 4, 0x01, 0, false},
+    {"HtrSuspendByPwrMng", nullptr, 284, FieldType::BOOL, 0, 0x01, 0, false},
+    {"Htr2SuspendByPwrMng", nullptr, 284, FieldType::BOOL, 1, 0x01, 0, false},
+    {"P1HStuck", nullptr, 284, FieldType::BOOL, 3, 0x01, 0, false},
+    {"P2HStuck", nullptr, 284, FieldType::BOOL, 4, 0x01, 0, false},
+    {"HeaterStuck", nullptr, 284, FieldType::BOOL, 5, 0x01, 0, false},
+    {"RelayStuck", nullptr, 284, FieldType::BOOL, 6, 0x01, 0, false},
+    {"PackBootID", nullptr, 285, FieldType::WORD, 0, 0xFF, 0, false},
+    {"PackBootRev", nullptr, 287, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"PackBootRel", nullptr, 288, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"PackType", LOG_VALUES_9, 289, FieldType::ENUM, 0, 0xFF, 11, false},
+    {"PackMemRange", LOG_VALUES_10, 290, FieldType::ENUM, 0, 0x03, 4, false},
+    {"PackRegion", LOG_VALUES_11, 290, FieldType::ENUM, 2, 0x01, 2, false},
+    {"PackCoreID", nullptr, 291, FieldType::WORD, 0, 0xFF, 0, false},
+    {"PackCoreRev", nullptr, 293, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"PackCoreRel", nullptr, 294, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"PackConfigLib", nullptr, 295, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"PackStatusLib", nullptr, 296, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"PackConfID", nullptr, 297, FieldType::WORD, 0, 0xFF, 0, false},
+    {"PackConfRev", nullptr, 299, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"PackConfRel", nullptr, 300, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"PackNumberOfConf", nullptr, 301, FieldType::WORD, 0, 0xFF, 0, false},
+    {"UdPumpTime", nullptr, 303, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"UdQuietTime", nullptr, 304, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"UdLightTime", nullptr, 305, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"UdL120Time", nullptr, 306, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"UdLi", LOG_VALUES_1, 307, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"UdL120", LOG_VALUES_2, 308, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"RhHrKinNoFlo", nullptr, 309, FieldType::BOOL, 0, 0x01, 0, false},
+    {"RhNoFloXTries", LOG_VALUES_12, 309, FieldType::ENUM, 1, 0x03, 4, false},
+    {"FLCErr", nullptr, 309, FieldType::BOOL, 3, 0x01, 0, false},
+    {"LockMode", LOG_VALUES_13, 310, FieldType::ENUM, 0, 0xFF, 3, true},
+    {"inTCipDelay", nullptr, 311, FieldType::WORD, 0, 0xFF, 0, false},
+    {"SwmRisk", LOG_VALUES_14, 313, FieldType::ENUM, 0, 0xFF, 5, false},
+    {"SlaveFloDetected", nullptr, 314, FieldType::BOOL, 0, 0x01, 0, false},
+    {"SlaveKinNoFloErr", nullptr, 315, FieldType::BOOL, 0, 0x01, 0, false},
+    {"SlaveNoFloErr", nullptr, 315, FieldType::BOOL, 1, 0x01, 0, false},
+    {"PackLogTrig", LOG_VALUES_15, 316, FieldType::ENUM, 0, 0x01, 2, true},
+    {"RhWaterTemp", nullptr, 317, FieldType::TEMP, 0, 0xFF, 0, false},
+    {"Menu", LOG_VALUES_16, 319, FieldType::ENUM, 0, 0xFF, 26, false},
+    {"SOut1", LOG_VALUES_17, 320, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"SOut2", LOG_VALUES_17, 321, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"SOut3", LOG_VALUES_17, 322, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"SOut4", LOG_VALUES_17, 323, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"SOut5", LOG_VALUES_17, 324, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"SOut6", LOG_VALUES_18, 325, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"SOut7", LOG_VALUES_18, 326, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"SOutHtr", LOG_VALUES_19, 326, FieldType::ENUM, 0, 0xFF, 15, true},
+    {"SOut1Cur", nullptr, 327, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SOut8", LOG_VALUES_18, 327, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"SOut2Cur", nullptr, 328, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SOut9", LOG_VALUES_18, 328, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"SOut10", LOG_VALUES_18, 329, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"SOut3Cur", nullptr, 329, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SOut11", LOG_VALUES_18, 330, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"SOut4Cur", nullptr, 330, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SOut12", LOG_VALUES_18, 331, FieldType::ENUM, 0, 0xFF, 28, true},
+    {"SOut5Cur", nullptr, 331, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SDirect", LOG_VALUES_20, 332, FieldType::ENUM, 0, 0xFF, 12, true},
+    {"SDirect2", LOG_VALUES_20, 333, FieldType::ENUM, 0, 0xFF, 12, true},
+    {"SOutHtrCur", nullptr, 333, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SOut6Cur", nullptr, 340, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SOut7Cur", nullptr, 341, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SOut8Cur", nullptr, 342, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SOut9Cur", nullptr, 343, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SOut10Cur", nullptr, 344, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SOut11Cur", nullptr, 345, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SOut12Cur", nullptr, 346, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SDirectCur", nullptr, 347, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SDirect2Cur", nullptr, 348, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"SlaveHtrSuspendByPwrMng", nullptr, 350, FieldType::BOOL, 0, 0x01, 0, false},
+    {"SlaveHtr2SuspendByPwrMng", nullptr, 350, FieldType::BOOL, 1, 0x01, 0, false},
+    {"SlaveP1HStuck", nullptr, 350, FieldType::BOOL, 3, 0x01, 0, false},
+    {"SlaveP2HStuck", nullptr, 350, FieldType::BOOL, 4, 0x01, 0, false},
+    {"SlaveHtrStuck", nullptr, 350, FieldType::BOOL, 5, 0x01, 0, false},
+    {"SlaveRelayStuck", nullptr, 350, FieldType::BOOL, 6, 0x01, 0, false},
+    {"SlaveHLErr", nullptr, 351, FieldType::BOOL, 0, 0x01, 0, false},
+    {"SlaveRegProbeErr", nullptr, 351, FieldType::BOOL, 1, 0x01, 0, false},
+    {"SlaveKinPumpOff", nullptr, 351, FieldType::BOOL, 2, 0x01, 0, false},
+    {"SlaveRegOverHeat", nullptr, 351, FieldType::BOOL, 3, 0x01, 0, false},
+    {"SlaveRegSlope", nullptr, 351, FieldType::BOOL, 4, 0x01, 0, false},
+    {"SlaveOverTemp", nullptr, 352, FieldType::BOOL, 1, 0x01, 0, false},
+    {"SlaveThermFuseErr", nullptr, 352, FieldType::BOOL, 3, 0x01, 0, false},
+    {"SlaveThermistanceErr", nullptr, 353, FieldType::BOOL, 0, 0x01, 0, false},
+    {"SlaveAmbiantOHLevel2", nullptr, 353, FieldType::BOOL, 1, 0x01, 0, false},
+    {"SlaveSwmPurge", nullptr, 353, FieldType::BOOL, 5, 0x01, 0, false},
+    {"SlaveSwmActive", nullptr, 353, FieldType::BOOL, 6, 0x01, 0, false},
+    {"SlaveMissingErr", nullptr, 354, FieldType::BOOL, 0, 0x01, 0, false},
+    {"SwmAdc", nullptr, 355, FieldType::WORD, 0, 0xFF, 0, false},
+    {"KeypadType", LOG_VALUES_21, 357, FieldType::ENUM, 0, 0xFF, 15, false},
+    {"KeypadID", nullptr, 358, FieldType::WORD, 0, 0xFF, 0, false},
+    {"KeypadRev", nullptr, 360, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"KeypadRel", nullptr, 361, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"UdWaterFallTime", nullptr, 362, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"UdWaterfall", LOG_VALUES_2, 363, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"DealerLockStatus", LOG_VALUES_13, 364, FieldType::ENUM, 0, 0xFF, 3, false},
+    {"DealerLockSeed", nullptr, 365, FieldType::WORD, 0, 0xFF, 0, false},
+    {"DealerLockKey", nullptr, 367, FieldType::WORD, 0, 0xFF, 0, true},
+    {"UdAuxTime", nullptr, 369, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"UdAux", LOG_VALUES_2, 370, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"inFloRatio", nullptr, 371, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"inFloRatioMinimum", nullptr, 372, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"inFloRatioMaximum", nullptr, 373, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"inFloErrorType", LOG_VALUES_22, 374, FieldType::ENUM, 0, 0xFF, 5, true},
+    {"ForceCheckFlo", nullptr, 375, FieldType::BOOL, 0, 0x01, 0, true},
+    {"PackReset", LOG_VALUES_23, 376, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"inFloJustReset", nullptr, 376, FieldType::BOOL, 0, 0x01, 0, false},
+    {"SideHeatingDegG", nullptr, 377, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"CoolZoneDetected", nullptr, 378, FieldType::BOOL, 0, 0x01, 0, false},
+    {"ModbusHeatPumpDetected", nullptr, 378, FieldType::BOOL, 1, 0x01, 0, false},
+    {"HPCResHeaterRequest", nullptr, 378, FieldType::BOOL, 4, 0x01, 0, false},
+    {"HPCHeatRequest", nullptr, 378, FieldType::BOOL, 5, 0x01, 0, false},
+    {"HPCChillRequest", nullptr, 378, FieldType::BOOL, 6, 0x01, 0, false},
+    {"HPCAutoMode", LOG_VALUES_24, 378, FieldType::ENUM, 7, 0x01, 2, true},
+    {"HPCState", LOG_VALUES_25, 379, FieldType::ENUM, 0, 0xFF, 22, false},
+    {"RemoteProgOutputAction", LOG_VALUES_8, 380, FieldType::ENUM, 0, 0xFF, 5, true},
+    {"RemoteProgOutputDur", nullptr, 381, FieldType::TIME, 0, 0xFF, 0, true},
+    {"SilentModeActive", nullptr, 383, FieldType::BOOL, 0, 0x01, 0, false},
+    {"InGridDetected", nullptr, 384, FieldType::BOOL, 0, 0x01, 0, false},
+    {"ExerciseDetectedType", LOG_VALUES_26, 385, FieldType::ENUM, 0, 0xFF, 3, false},
+    {"ExerciseIntensity", nullptr, 386, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"ModbusHeatPumpErrorID", nullptr, 387, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"ProgOutputRequest", nullptr, 388, FieldType::BOOL, 0, 0x01, 0, false},
+    {"ProgOutputUserOff", nullptr, 388, FieldType::BOOL, 1, 0x01, 0, false},
+    {"ModbusHeatPumpType", LOG_VALUES_27, 389, FieldType::ENUM, 0, 0xFF, 3, false},
+    {"ModbusHeatPumpAmbient", nullptr, 390, FieldType::WORD, 0, 0xFF, 0, false},
+};
+
+// Status versions <= 50: only the fields with known positions
+static constexpr FieldDesc LOG_FIELDS_V50[] = {
+    {"Hours", nullptr, 284, FieldType::BYTE, 0, 0xFF, 0, false},
+    {"QuietState", LOG_VALUES_0, 285, FieldType::ENUM, 0, 0xFF, 4, true},
+    {"UdP5", LOG_VALUES_1, 0, FieldType::NONE, 0, 0x01, 2, true},
+    {"UdBL", LOG_VALUES_2, 0, FieldType::NONE, 1, 0x01, 2, true},
+    {"UdP1", LOG_VALUES_3, 258, FieldType::ENUM, 0, 0x03, 3, true},
+    {"UdP2", LOG_VALUES_3, 258, FieldType::ENUM, 2, 0x03, 3, true},
+    {"UdP3", LOG_VALUES_3, 258, FieldType::ENUM, 4, 0x03, 3, true},
+    {"UdP4", LOG_VALUES_3, 258, FieldType::ENUM, 6, 0x03, 3, true},
+    {"P5", LOG_VALUES_4, 0, FieldType::NONE, 0, 0x01, 2, false},
+    {"BL", LOG_VALUES_2, 259, FieldType::ENUM, 1, 0x01, 2, false},
+    {"CP", LOG_VALUES_2, 259, FieldType::ENUM, 2, 0x01, 2, false},
+    {"O3", LOG_VALUES_2, 0, FieldType::NONE, 3, 0x01, 2, false},
+    {"L120", LOG_VALUES_2, 0, FieldType::NONE, 4, 0x01, 2, false},
+    {"Heating", LOG_VALUES_5, 0, FieldType::NONE, 5, 0x03, 4, false},
+    {"MSTR_HEATER", LOG_VALUES_2, 259, FieldType::ENUM, 5, 0x01, 2, false},
+    {"SLV_HEATER", LOG_VALUES_2, 0, FieldType::NONE, 6, 0x01, 2, false},
+    {"Waterfall", LOG_VALUES_2, 259, FieldType::ENUM, 7, 0x01, 2, false},
+    {"P1", LOG_VALUES_6, 260, FieldType::ENUM, 0, 0x03, 3, false},
+    {"P2", LOG_VALUES_6, 260, FieldType::ENUM, 2, 0x03, 3, false},
+    {"P3", LOG_VALUES_6, 260, FieldType::ENUM, 4, 0x03, 3, false},
+    {"P4", LOG_VALUES_6, 260, FieldType::ENUM, 6, 0x03, 3, false},
+    {"FilterAccess", LOG_VALUES_7, 0, FieldType::NONE, 0, 0x01, 2, true},
+    {"ProgOutputAccess", LOG_VALUES_7, 0, FieldType::NONE, 1, 0x01, 2, true},
+    {"EconomyAccess", LOG_VALUES_7, 0, FieldType::NONE, 2, 0x01, 2, true},
+    {"RemoteFiltAction", LOG_VALUES_8, 0, FieldType::NONE, 0, 0xFF, 5, true},
+    {"RemoteFiltDur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"RemoteFiltDurPerDay", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"RemoteEconAction", LOG_VALUES_8, 0, FieldType::NONE, 0, 0xFF, 5, true},
+    {"RemoteEconDur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"RemoteConfigIndex", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"RemoteNbOfPhases", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"RemoteBreakerIndex", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"Clean", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"Purge", nullptr, 0, FieldType::NONE, 2, 0x01, 0, false},
+    {"FiltSuspendByUD", nullptr, 0, FieldType::NONE, 3, 0x01, 0, false},
+    {"FiltSuspendedByOT", nullptr, 0, FieldType::NONE, 4, 0x01, 0, false},
+    {"FiltSuspendedByErr", nullptr, 0, FieldType::NONE, 5, 0x01, 0, false},
+    {"OverTemp", nullptr, 0, FieldType::NONE, 1, 0x01, 0, false},
+    {"CPOT", nullptr, 0, FieldType::NONE, 2, 0x01, 0, false},
+    {"ThermFuseErr", nullptr, 0, FieldType::NONE, 3, 0x01, 0, false},
+    {"inFloPressureSwDetected", nullptr, 0, FieldType::NONE, 5, 0x01, 0, false},
+    {"StickDetected", nullptr, 0, FieldType::NONE, 6, 0x01, 0, false},
+    {"RealSetPointG", nullptr, 274, FieldType::TEMP, 0, 0xFF, 0, false},
+    {"DisplayedTempG", nullptr, 276, FieldType::TEMP, 0, 0xFF, 0, false},
+    {"TempNotValid", nullptr, 0, FieldType::NONE, 2, 0x01, 0, false},
+    {"ExtProbeDetected", nullptr, 0, FieldType::NONE, 6, 0x01, 0, false},
+    {"RhFloDetected", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"CheckFlo", nullptr, 0, FieldType::NONE, 2, 0x01, 0, false},
+    {"ProgEconActive", nullptr, 0, FieldType::NONE, 1, 0x01, 0, false},
+    {"EconActive", nullptr, 0, FieldType::NONE, 2, 0x01, 0, true},
+    {"ThermistanceErr", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"AmbiantOHLevel2", nullptr, 0, FieldType::NONE, 1, 0x01, 0, false},
+    {"SwmPurgeSusp", nullptr, 0, FieldType::NONE, 3, 0x01, 0, false},
+    {"SwmPurge", nullptr, 0, FieldType::NONE, 5, 0x01, 0, false},
+    {"SwmActive", nullptr, 0, FieldType::NONE, 6, 0x01, 0, false},
+    {"RhHwHL", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"RhRegProbeErr", nullptr, 0, FieldType::NONE, 1, 0x01, 0, false},
+    {"KinPumpOff", nullptr, 0, FieldType::NONE, 2, 0x01, 0, false},
+    {"RegOverHeat", nullptr, 0, FieldType::NONE, 3, 0x01, 0, false},
+    {"RhRegSlope", nullptr, 0, FieldType::NONE, 4, 0x01, 0, false},
+    {"HtrSuspendByPwrMng", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"Htr2SuspendByPwrMng", nullptr, 0, FieldType::NONE, 1, 0x01, 0, false},
+    {"P1HStuck", nullptr, 0, FieldType::NONE, 3, 0x01, 0, false},
+    {"P2HStuck", nullptr, 0, FieldType::NONE, 4, 0x01, 0, false},
+    {"HeaterStuck", nullptr, 0, FieldType::NONE, 5, 0x01, 0, false},
+    {"RelayStuck", nullptr, 0, FieldType::NONE, 6, 0x01, 0, false},
+    {"PackBootID", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"PackBootRev", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"PackBootRel", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"PackType", LOG_VALUES_9, 288, FieldType::ENUM, 0, 0xFF, 11, false},
+    {"PackMemRange", LOG_VALUES_10, 0, FieldType::NONE, 0, 0x03, 4, false},
+    {"PackRegion", LOG_VALUES_11, 0, FieldType::NONE, 2, 0x01, 2, false},
+    {"PackCoreID", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"PackCoreRev", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"PackCoreRel", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"PackConfigLib", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"PackStatusLib", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"PackConfID", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"PackConfRev", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"PackConfRel", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"PackNumberOfConf", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"UdPumpTime", nullptr, 302, FieldType::BYTE, 0, 0xFF, 0, true},
+    {"UdQuietTime", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"UdLightTime", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"UdL120Time", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"UdLi", LOG_VALUES_1, 307, FieldType::ENUM, 0, 0xFF, 2, true},
+    {"UdL120", LOG_VALUES_2, 0, FieldType::NONE, 0, 0xFF, 2, true},
+    {"RhHrKinNoFlo", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"RhNoFloXTries", LOG_VALUES_12, 0, FieldType::NONE, 1, 0x03, 4, false},
+    {"FLCErr", nullptr, 0, FieldType::NONE, 3, 0x01, 0, false},
+    {"LockMode", LOG_VALUES_13, 309, FieldType::ENUM, 0, 0xFF, 3, true},
+    {"inTCipDelay", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"SwmRisk", LOG_VALUES_14, 0, FieldType::NONE, 0, 0xFF, 5, false},
+    {"SlaveFloDetected", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"SlaveKinNoFloErr", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"SlaveNoFloErr", nullptr, 0, FieldType::NONE, 1, 0x01, 0, false},
+    {"PackLogTrig", LOG_VALUES_15, 0, FieldType::NONE, 0, 0x01, 2, true},
+    {"RhWaterTemp", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"Menu", LOG_VALUES_16, 0, FieldType::NONE, 0, 0xFF, 26, false},
+    {"SOut1", LOG_VALUES_17, 0, FieldType::NONE, 0, 0xFF, 28, true},
+    {"SOut2", LOG_VALUES_17, 0, FieldType::NONE, 0, 0xFF, 28, true},
+    {"SOut3", LOG_VALUES_17, 0, FieldType::NONE, 0, 0xFF, 28, true},
+    {"SOut4", LOG_VALUES_17, 0, FieldType::NONE, 0, 0xFF, 28, true},
+    {"SOut5", LOG_VALUES_17, 0, FieldType::NONE, 0, 0xFF, 28, true},
+    {"SOut6", LOG_VALUES_18, 0, FieldType::NONE, 0, 0xFF, 28, true},
+    {"SOut7", LOG_VALUES_18, 0, FieldType::NONE, 0, 0xFF, 28, true},
+    {"SOutHtr", LOG_VALUES_19, 0, FieldType::NONE, 0, 0xFF, 15, true},
+    {"SOut1Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SOut8", LOG_VALUES_18, 0, FieldType::NONE, 0, 0xFF, 28, true},
+    {"SOut2Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SOut9", LOG_VALUES_18, 0, FieldType::NONE, 0, 0xFF, 28, true},
+    {"SOut10", LOG_VALUES_18, 0, FieldType::NONE, 0, 0xFF, 28, true},
+    {"SOut3Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SOut11", LOG_VALUES_18, 0, FieldType::NONE, 0, 0xFF, 28, true},
+    {"SOut4Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SOut12", LOG_VALUES_18, 0, FieldType::NONE, 0, 0xFF, 28, true},
+    {"SOut5Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SDirect", LOG_VALUES_20, 0, FieldType::NONE, 0, 0xFF, 12, true},
+    {"SDirect2", LOG_VALUES_20, 0, FieldType::NONE, 0, 0xFF, 12, true},
+    {"SOutHtrCur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SOut6Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SOut7Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SOut8Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SOut9Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SOut10Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SOut11Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SOut12Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SDirectCur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SDirect2Cur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SlaveHtrSuspendByPwrMng", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"SlaveHtr2SuspendByPwrMng", nullptr, 0, FieldType::NONE, 1, 0x01, 0, false},
+    {"SlaveP1HStuck", nullptr, 0, FieldType::NONE, 3, 0x01, 0, false},
+    {"SlaveP2HStuck", nullptr, 0, FieldType::NONE, 4, 0x01, 0, false},
+    {"SlaveHtrStuck", nullptr, 0, FieldType::NONE, 5, 0x01, 0, false},
+    {"SlaveRelayStuck", nullptr, 0, FieldType::NONE, 6, 0x01, 0, false},
+    {"SlaveHLErr", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"SlaveRegProbeErr", nullptr, 0, FieldType::NONE, 1, 0x01, 0, false},
+    {"SlaveKinPumpOff", nullptr, 0, FieldType::NONE, 2, 0x01, 0, false},
+    {"SlaveRegOverHeat", nullptr, 0, FieldType::NONE, 3, 0x01, 0, false},
+    {"SlaveRegSlope", nullptr, 0, FieldType::NONE, 4, 0x01, 0, false},
+    {"SlaveOverTemp", nullptr, 0, FieldType::NONE, 1, 0x01, 0, false},
+    {"SlaveThermFuseErr", nullptr, 0, FieldType::NONE, 3, 0x01, 0, false},
+    {"SlaveThermistanceErr", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"SlaveAmbiantOHLevel2", nullptr, 0, FieldType::NONE, 1, 0x01, 0, false},
+    {"SlaveSwmPurge", nullptr, 0, FieldType::NONE, 5, 0x01, 0, false},
+    {"SlaveSwmActive", nullptr, 0, FieldType::NONE, 6, 0x01, 0, false},
+    {"SlaveMissingErr", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"SwmAdc", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"KeypadType", LOG_VALUES_21, 0, FieldType::NONE, 0, 0xFF, 15, false},
+    {"KeypadID", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"KeypadRev", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"KeypadRel", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"UdWaterFallTime", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"UdWaterfall", LOG_VALUES_2, 0, FieldType::NONE, 0, 0xFF, 2, true},
+    {"DealerLockStatus", LOG_VALUES_13, 0, FieldType::NONE, 0, 0xFF, 3, false},
+    {"DealerLockSeed", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"DealerLockKey", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"UdAuxTime", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"UdAux", LOG_VALUES_2, 0, FieldType::NONE, 0, 0xFF, 2, true},
+    {"inFloRatio", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"inFloRatioMinimum", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"inFloRatioMaximum", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"inFloErrorType", LOG_VALUES_22, 0, FieldType::NONE, 0, 0xFF, 5, true},
+    {"ForceCheckFlo", nullptr, 0, FieldType::NONE, 0, 0x01, 0, true},
+    {"PackReset", LOG_VALUES_23, 0, FieldType::NONE, 0, 0xFF, 2, true},
+    {"inFloJustReset", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"SideHeatingDegG", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"CoolZoneDetected", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"ModbusHeatPumpDetected", nullptr, 0, FieldType::NONE, 1, 0x01, 0, false},
+    {"HPCResHeaterRequest", nullptr, 0, FieldType::NONE, 4, 0x01, 0, false},
+    {"HPCHeatRequest", nullptr, 0, FieldType::NONE, 5, 0x01, 0, false},
+    {"HPCChillRequest", nullptr, 0, FieldType::NONE, 6, 0x01, 0, false},
+    {"HPCAutoMode", LOG_VALUES_24, 0, FieldType::NONE, 7, 0x01, 2, true},
+    {"HPCState", LOG_VALUES_25, 0, FieldType::NONE, 0, 0xFF, 22, false},
+    {"RemoteProgOutputAction", LOG_VALUES_8, 0, FieldType::NONE, 0, 0xFF, 5, true},
+    {"RemoteProgOutputDur", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"SilentModeActive", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"InGridDetected", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"ExerciseDetectedType", LOG_VALUES_26, 0, FieldType::NONE, 0, 0xFF, 3, false},
+    {"ExerciseIntensity", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, true},
+    {"ModbusHeatPumpErrorID", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+    {"ProgOutputRequest", nullptr, 0, FieldType::NONE, 0, 0x01, 0, false},
+    {"ProgOutputUserOff", nullptr, 0, FieldType::NONE, 1, 0x01, 0, false},
+    {"ModbusHeatPumpType", LOG_VALUES_27, 0, FieldType::NONE, 0, 0xFF, 3, false},
+    {"ModbusHeatPumpAmbient", nullptr, 0, FieldType::NONE, 0, 0xFF, 0, false},
+};
+
+static_assert(sizeof(LOG_FIELDS_V65) / sizeof(FieldDesc) == (size_t) LogField::COUNT, "LOG_FIELDS_V65 size");
+static_assert(sizeof(LOG_FIELDS_V50) / sizeof(FieldDesc) == (size_t) LogField::COUNT, "LOG_FIELDS_V50 size");
+
+}  // namespace gecko_spa
+}  // namespace esphome
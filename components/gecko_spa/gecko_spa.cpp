@@ -1,17 +1,26 @@
 #include "gecko_spa.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include <cinttypes>
+#include <cmath>
 #include <ctime>
 
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 namespace esphome {
 namespace gecko_spa {
 
 static const char *const TAG = "gecko_spa";
 
-// GO keep-alive message
-const uint8_t GeckoSpa::GO_MESSAGE[15] = {
-    0x17, 0x00, 0x00, 0x00, 0x00, 0x17, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x47, 0x4F  // "GO"
-};
+// Command target names for logging, indexed by CommandTarget up to WRITE
+static const char *const COMMAND_NAMES[] = {"light", "circ", "P1", "P2", "P3", "P4", "program", "setpoint", "write"};
+
+static const char *command_name(size_t target) {
+  return COMMAND_NAMES[target < (size_t) CommandTarget::WRITE ? target : (size_t) CommandTarget::WRITE];
+}
 
 void GeckoSpa::setup() {
   ESP_LOGI(TAG, "GeckoSpa starting");
@@ -19,9 +28,97 @@ void GeckoSpa::setup() {
     reset_pin_->setup();
     reset_pin_->digital_write(true);  // RST is active LOW, keep HIGH
   }
+  trace_.init(trace_buffer_size_);
+  for (size_t i = 0; i < (size_t) MeteredDevice::COUNT; i++)
+    metering_ |= runtime_sensors_[i] != nullptr || energy_sensors_[i] != nullptr;
+  metering_ |= total_energy_sensor_ != nullptr;
+  if (metering_ && meter_save_interval_ > 0) {
+    meter_pref_ = global_preferences->make_preference<MeterTotals>(fnv1_hash("gecko_spa_meter"), true);
+    restore_meter();
+  }
+  if (metering_)
+    mark_dirty(PublishEntity::METERS);  // Restored totals, or zeros
+  if (snapshot_interval_ > 0) {
+    snapshot_pref_ = global_preferences->make_preference<SpaSnapshot>(fnv1_hash("gecko_spa_snapshot"), true);
+    restore_snapshot();
+  }
+  // Proxy may already be running (no boot banner), so configure it now as well
+  configure_proxy();
+  if (rx_task_)
+    start_rx_task();
+}
+
+void GeckoSpa::dump_config() {
+  ESP_LOGCONFIG(TAG, "Gecko Spa:");
+  ESP_LOGCONFIG(TAG, "  Binary link: %s, proxy reassembly: %s, proxy ACKs: %s, receive task: %s",
+                YESNO(binary_link_), YESNO(proxy_dedup_), YESNO(proxy_auto_ack_), YESNO(rx_task_));
+  // RAM held by this instance, so buffer sizes can be weighed against each other
+  ESP_LOGCONFIG(TAG, "  RAM: %u bytes per instance", (unsigned) sizeof(GeckoSpa));
+  ESP_LOGCONFIG(TAG, "    Receive arena: %u (%u message + %u frame + CRC)", (unsigned) sizeof(rx_arena_),
+                MAX_MESSAGE_LEN, MAX_FRAME_LEN);
+  ESP_LOGCONFIG(TAG, "    Last status: %u", (unsigned) sizeof(last_status_));
+  ESP_LOGCONFIG(TAG, "    Command queue: %u", (unsigned) sizeof(commands_));
+  ESP_LOGCONFIG(TAG, "    Link stats: %u", (unsigned) sizeof(stats_));
+  ESP_LOGCONFIG(TAG, "  Heap: %u bytes trace buffer, %u bytes receive queue", trace_buffer_size_,
+                (unsigned) (rx_task_ ? RX_QUEUE_SLOTS * sizeof(decltype(rx_queue_)::Entry) : 0));
+  if (snapshot_interval_ > 0)
+    ESP_LOGCONFIG(TAG, "  Snapshot: %u bytes of flash", (unsigned) sizeof(SpaSnapshot));
+  if (metering_) {
+    ESP_LOGCONFIG(TAG, "  Meter: heater %uW, circulation %uW, blower %uW, pumps %u/%u/%u/%uW",
+                  meter_.power_w[0], meter_.power_w[1], meter_.power_w[2], meter_.power_w[3], meter_.power_w[4],
+                  meter_.power_w[5], meter_.power_w[6]);
+    if (meter_save_interval_ > 0)
+      ESP_LOGCONFIG(TAG, "    Totals: %u bytes of flash, saved every %" PRIu32 " s at most",
+                    (unsigned) sizeof(MeterTotals), meter_save_interval_ / 1000);
+  }
+}
+
+void GeckoSpa::on_safe_shutdown() {
+  // Keep the run time counted since the last save across an OTA or reboot
+  if (meter_dirty_ && meter_save_interval_ > 0)
+    save_meter();
+}
+
+void GeckoSpa::start_rx_task() {
+#ifdef USE_ESP32
+  rx_queue_.init(RX_QUEUE_SLOTS);
+  rx_task_running_ = true;
+  // Pinned to the last core, away from the WiFi stack on core 0 of dual-core chips
+  if (xTaskCreatePinnedToCore(rx_task, "gecko_rx", RX_TASK_STACK, this, RX_TASK_PRIORITY, nullptr,
+                              portNUM_PROCESSORS - 1) == pdPASS) {
+    ESP_LOGI(TAG, "Receive task started");
+    return;
+  }
+  rx_task_running_ = false;
+  ESP_LOGE(TAG, "Failed to start receive task, receiving in loop()");
+#else
+  ESP_LOGW(TAG, "Receive task needs FreeRTOS, receiving in loop()");
+#endif
+}
+
+void GeckoSpa::rx_task(void *arg) {
+#ifdef USE_ESP32
+  GeckoSpa *spa = static_cast<GeckoSpa *>(arg);
+  while (true) {
+    spa->drain_uart();
+    vTaskDelay(1);  // The UART FIFO holds ~11 ms at 115200 baud
+  }
+#endif
+}
+
+void GeckoSpa::configure_proxy() {
+  // Older proxies ignore commands they don't know, so V1 behaviour is the fallback.
+  // Without a reset pin the proxy keeps its modes across an ESP reboot, so modes that
+  // are off in the config are turned off explicitly.
+  write_str(binary_link_ ? "MODE:V2\n" : "MODE:V1\n");
+  write_str(proxy_auto_ack_ ? "ACK:1\n" : "ACK:0\n");
+  if (!proxy_dedup_ || !binary_link_)
+    write_str("DEDUP:0\n");
 }
 
 void GeckoSpa::loop() {
+  uint32_t loop_start = micros();
+
   // Handle non-blocking reset pulse completion (100ms)
   if (reset_in_progress_ && (millis() - reset_start_time_ > 100)) {
     if (reset_pin_) {
@@ -31,134 +128,423 @@ void GeckoSpa::loop() {
     ESP_LOGI(TAG, "Arduino reset complete");
   }
 
-  // Read UART lines from Arduino proxy
-  while (available()) {
-    char c = read();
-    if (c == '\n' || c == '\r') {
-      if (uart_pos_ > 0) {
-        uart_buffer_[uart_pos_] = '\0';
-        process_proxy_message(uart_buffer_);
-        uart_pos_ = 0;
-      }
-    } else if (uart_pos_ < sizeof(uart_buffer_) - 1) {
-      uart_buffer_[uart_pos_++] = c;
-    }
-  }
+  if (rx_task_running_)
+    process_rx_queue();
+  else
+    drain_uart();
 
-  // Check connection timeout (1 minute)
-  if (connected_ && (millis() - last_i2c_time_ > 60000)) {
+  // Check connection timeout (1 minute). The receive task may update last_i2c_time_,
+  // so read it before millis()
+  uint32_t last_traffic = last_i2c_time_;
+  if (connected_ && (millis() - last_traffic > 60000)) {
     connected_ = false;
     if (connected_sensor_)
       connected_sensor_->publish_state(false);
     ESP_LOGW(TAG, "Spa connection lost (timeout)");
+    go_interval_ = GO_BASE_INTERVAL_MS;
     reset_arduino();  // Reset Arduino on disconnect
   }
 
-  // Send GO keep-alive every 23 seconds (triggers handshake sequence)
-  if (millis() - last_go_send_time_ > 23000) {
-    last_go_send_time_ = millis();
-    send_i2c_message(GO_MESSAGE, 15);
-    ESP_LOGD(TAG, "Sent GO keep-alive");
+  service_commands();
+  service_handshake();
+  flush_publishes();
+
+  if (millis() - stats_.window_start >= metrics_interval_)
+    publish_metrics();
+
+  // Flash writes are rate-limited: at most one snapshot per snapshot_interval_
+  if (snapshot_dirty_ && snapshot_interval_ > 0 && millis() - last_snapshot_time_ >= snapshot_interval_)
+    save_snapshot();
+  if (meter_dirty_ && meter_save_interval_ > 0 && millis() - last_meter_save_ >= meter_save_interval_)
+    save_meter();
+  stats_.loop_time.add(micros() - loop_start);
+}
+
+// Handshake state names for logging and the handshake text sensor, indexed by HandshakeState
+static const char *const HANDSHAKE_NAMES[] = {"idle", "waiting for XML", "waiting for clock", "waiting for LO",
+                                              "complete", "stalled"};
+
+void GeckoSpa::service_handshake() {
+  uint32_t now = millis();
+
+  // A step that doesn't arrive in time restarts the handshake straight away
+  if (handshake_state_ >= HandshakeState::WAIT_XML && handshake_state_ <= HandshakeState::WAIT_LO &&
+      now - handshake_step_time_ > HANDSHAKE_STEP_MS) {
+    if (handshake_attempts_ < HANDSHAKE_MAX_ATTEMPTS) {
+      ESP_LOGW(TAG, "Handshake stalled %s, resending GO", HANDSHAKE_NAMES[(size_t) handshake_state_]);
+      go_pending_ = true;
+    } else {
+      ESP_LOGW(TAG, "No handshake after %d GOs, retrying in %u s", handshake_attempts_,
+               (unsigned) (GO_BASE_INTERVAL_MS / 1000));
+      set_handshake_state(HandshakeState::STALLED);
+      handshake_attempts_ = 0;
+      go_interval_ = GO_BASE_INTERVAL_MS;
+    }
+  }
+
+  // Status has stopped: don't wait for the keep-alive
+  bool status_flowing = stats_.last_status_time != 0 && now - stats_.last_status_time < STATUS_STALL_MS;
+  if (handshake_state_ == HandshakeState::COMPLETE && stats_.last_status_time != 0 && !status_flowing &&
+      now - last_go_send_time_ > STATUS_STALL_MS && !go_pending_) {
+    ESP_LOGW(TAG, "No status for %u s, resending GO", (unsigned) ((now - stats_.last_status_time) / 1000));
+    go_pending_ = true;
+    go_interval_ = GO_BASE_INTERVAL_MS;
   }
+
+  // Keep-alive, backed off while the spa is healthy
+  if (!go_pending_ && now - last_go_send_time_ >= go_interval_) {
+    go_pending_ = true;
+    if (status_flowing && handshake_state_ == HandshakeState::COMPLETE) {
+      go_interval_ = go_interval_ >= GO_MAX_INTERVAL_MS / 2 ? GO_MAX_INTERVAL_MS : go_interval_ * 2;
+    } else {
+      go_interval_ = GO_BASE_INTERVAL_MS;
+    }
+  }
+
+  // GO shares the bus pacing with commands, which go first
+  if (!go_pending_ || now - last_tx_time_ < COMMAND_PACING_MS)
+    return;
+  go_pending_ = false;
+  last_go_send_time_ = now;
+  handshake_attempts_++;
+  send_i2c_message(GoFrame::BYTES.data(), GoFrame::LEN);
+  ESP_LOGD(TAG, "Sent GO (attempt %d, next keep-alive in %u s)", handshake_attempts_, (unsigned) (go_interval_ / 1000));
+  set_handshake_state(HandshakeState::WAIT_XML);
 }
 
+void GeckoSpa::set_handshake_state(HandshakeState state) {
+  handshake_step_time_ = millis();
+  if (state == handshake_state_)
+    return;
+  handshake_state_ = state;
+  ESP_LOGD(TAG, "Handshake %s", HANDSHAKE_NAMES[(size_t) state]);
+  if (state == HandshakeState::COMPLETE)
+    handshake_attempts_ = 0;
+  if (handshake_sensor_)
+    handshake_sensor_->publish_state(HANDSHAKE_NAMES[(size_t) state]);
+}
+
+// Read UART lines (V1) and 0x00-delimited binary frames (V2) from Arduino proxy,
+// in bulk chunks and bounded per call
+void GeckoSpa::drain_uart() {
+  uint8_t chunk[UART_CHUNK];
+  size_t budget = MAX_UART_PER_LOOP;
+  while (budget > 0) {
+    size_t n = available();
+    if (n == 0)
+      break;
+    if (n > sizeof(chunk))
+      n = sizeof(chunk);
+    if (n > budget)
+      n = budget;
+    if (!read_array(chunk, n))
+      break;
+    stats_.uart_bytes += n;
+    receive_bytes(chunk, n);
+    budget -= n;
+  }
+}
+
+// Hand a complete message or proxy line to loop(): queued when the receive task is
+// running, otherwise handled straight away
+void GeckoSpa::deliver(QueuedKind kind, const uint8_t *data, uint16_t len) {
+  if (!rx_task_running_) {
+    dispatch(kind, data, len);
+    return;
+  }
+  if (!rx_queue_.push(kind, data, len)) {
+    ESP_LOGW(TAG, "Receive queue full, dropped %d-byte message", len);
+    stats_.buffer_overflows++;
+  }
+}
+
+void GeckoSpa::dispatch(QueuedKind kind, const uint8_t *data, uint16_t len) {
+  switch (kind) {
+    case QueuedKind::FRAME:
+      handle_spa_frame(data, len);
+      break;
+    case QueuedKind::MESSAGE:
+      process_reassembled_message(data, len);
+      break;
+    case QueuedKind::PROXY_LINE:
+      process_proxy_message((const char *) data);
+      break;
+  }
+}
+
+void GeckoSpa::process_rx_queue() {
+  // Bounded by the queue size, since the task may keep adding entries
+  for (uint8_t i = 0; i < RX_QUEUE_SLOTS; i++) {
+    auto *entry = rx_queue_.front();
+    if (entry == nullptr)
+      break;
+    dispatch(entry->kind, entry->data, entry->len);
+    rx_queue_.pop();
+  }
+}
+
+void GeckoSpa::publish_metrics() {
+  uint32_t now = millis();
+  uint32_t elapsed = now - stats_.window_start;
+  if (elapsed == 0)
+    return;
+
+  float values[(size_t) MetricSensor::COUNT];
+  values[(size_t) MetricSensor::UART_RX_RATE] = stats_.uart_bytes * 1000.0f / elapsed;
+  values[(size_t) MetricSensor::FRAME_RATE] = stats_.window_frames * 60000.0f / elapsed;
+  values[(size_t) MetricSensor::FRAME_ERRORS] = stats_.frame_errors;
+  values[(size_t) MetricSensor::REASSEMBLY_ERRORS] = stats_.reassembly_errors;
+  values[(size_t) MetricSensor::BUFFER_OVERFLOWS] = stats_.buffer_overflows;
+  values[(size_t) MetricSensor::CHECKSUM_ERRORS] = stats_.checksum_errors;
+  values[(size_t) MetricSensor::SEQUENCE_ERRORS] = stats_.sequence_errors;
+  values[(size_t) MetricSensor::REASSEMBLY_TIMEOUTS] = stats_.reassembly_timeouts;
+  values[(size_t) MetricSensor::TX_ERRORS] = stats_.tx_errors;
+  values[(size_t) MetricSensor::TX_LATENCY] = stats_.tx_latency.average();
+  values[(size_t) MetricSensor::STATUS_INTERVAL] = stats_.status_interval.average();
+  values[(size_t) MetricSensor::COMMAND_LATENCY] = stats_.command_latency.average();
+  values[(size_t) MetricSensor::LOOP_TIME] = stats_.loop_time.average();
+  values[(size_t) MetricSensor::LOOP_TIME_MAX] = stats_.loop_time.max;
+
+  ESP_LOGD(TAG, "Link: %.0f B/s, %.1f frames/min, status every %.0f ms, loop %.0f us (max %u us), "
+           "errors %u/%u/%u/%u/%u/%u, tx %u failed", values[(size_t) MetricSensor::UART_RX_RATE],
+           values[(size_t) MetricSensor::FRAME_RATE], values[(size_t) MetricSensor::STATUS_INTERVAL],
+           values[(size_t) MetricSensor::LOOP_TIME], (unsigned) stats_.loop_time.max,
+           (unsigned) stats_.frame_errors, (unsigned) stats_.reassembly_errors,
+           (unsigned) stats_.buffer_overflows, (unsigned) stats_.checksum_errors,
+           (unsigned) stats_.sequence_errors, (unsigned) stats_.reassembly_timeouts,
+           (unsigned) stats_.tx_errors);
+
+  for (size_t i = 0; i < (size_t) MetricSensor::COUNT; i++) {
+    if (metric_sensors_[i])
+      metric_sensors_[i]->publish_state(values[i]);
+  }
+
+  if (frame_counts_sensor_) {
+    const uint32_t *f = stats_.frames;
+    char counts[128];
+    snprintf(counts, sizeof(counts), "status=%u config=%u part=%u notif=%u handshake=%u program=%u other=%u",
+             (unsigned) f[(size_t) FrameKind::STATUS], (unsigned) f[(size_t) FrameKind::CONFIG],
+             (unsigned) f[(size_t) FrameKind::PART], (unsigned) f[(size_t) FrameKind::NOTIFICATION],
+             (unsigned) f[(size_t) FrameKind::HANDSHAKE], (unsigned) f[(size_t) FrameKind::PROGRAM],
+             (unsigned) f[(size_t) FrameKind::OTHER]);
+    frame_counts_sensor_->publish_state(counts);
+  }
+
+  stats_.reset_window(now);
+}
+
+// Spa memory positions written by the switch and climate commands
+using LightWrite = FixedWrite<0x0133, 1>;     // UdLi
+using CircWrite = FixedWrite<0x016B, 1>;
+using Pump1Write = FixedWrite<0x0103, 1>;     // UdP1
+using Pump2Write = FixedWrite<0x0104, 1>;     // EXPERIMENTAL - sequential from P1
+using Pump3Write = FixedWrite<0x0105, 1>;     // EXPERIMENTAL
+using Pump4Write = FixedWrite<0x0106, 1>;     // EXPERIMENTAL
+using SetpointWrite = FixedWrite<0x0001, 2>;  // SetpointG, 1/18 degC
+static_assert(LightWrite::ZERO[19] == 0x72, "Light OFF frame checksum");
+
 void GeckoSpa::send_light_command(bool on) {
-  uint8_t cmd[20] = {
-      0x17, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x09, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x06, 0x46, 0x52, 0x51,
-      0x01, 0x33, (uint8_t)(on ? 0x01 : 0x00), 0x00};
-  cmd[19] = calc_checksum(cmd, 20);
-  send_i2c_message(cmd, 20);
-  ESP_LOGI(TAG, "Sent light %s command", on ? "ON" : "OFF");
+  uint8_t cmd[LightWrite::LEN];
+  LightWrite::fill(on ? 0x01 : 0x00, cmd);
+  queue_command(CommandTarget::LIGHT, cmd, LightWrite::LEN, on ? 1 : 0);
+  ESP_LOGI(TAG, "Queued light %s command", on ? "ON" : "OFF");
 }
 
 void GeckoSpa::send_circ_command(bool on) {
-  uint8_t cmd[20] = {
-      0x17, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x09, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x06, 0x46, 0x52, 0x51,
-      0x01, 0x6B, (uint8_t)(on ? 0x01 : 0x00), 0x00};
-  cmd[19] = calc_checksum(cmd, 20);
-  send_i2c_message(cmd, 20);
-  ESP_LOGI(TAG, "Sent circ %s command", on ? "ON" : "OFF");
+  uint8_t cmd[CircWrite::LEN];
+  CircWrite::fill(on ? 0x01 : 0x00, cmd);
+  queue_command(CommandTarget::CIRC, cmd, CircWrite::LEN, on ? 1 : 0);
+  ESP_LOGI(TAG, "Queued circ %s command", on ? "ON" : "OFF");
 }
 
 void GeckoSpa::send_pump1_command(uint8_t state) {
-  // P1 function ID: 0x03
   // State: 0=OFF, 2=ON/HIGH (P1 uses 0x02 for ON, not 0x01)
   uint8_t state_val = (state == 0) ? 0x00 : 0x02;
-
-  uint8_t cmd[20] = {
-      0x17, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x09, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x06, 0x46, 0x52, 0x51,
-      0x01, 0x03, state_val, 0x00};
-  cmd[19] = calc_checksum(cmd, 20);
-  send_i2c_message(cmd, 20);
-  ESP_LOGI(TAG, "Sent P1 state=%d command (val=0x%02X)", state, state_val);
+  uint8_t cmd[Pump1Write::LEN];
+  Pump1Write::fill(state_val, cmd);
+  queue_command(CommandTarget::PUMP1, cmd, Pump1Write::LEN, state != 0);
+  ESP_LOGI(TAG, "Queued P1 state=%d command (val=0x%02X)", state, state_val);
 }
 
 void GeckoSpa::send_pump2_command(uint8_t state) {
-  // P2 function ID: 0x04 (EXPERIMENTAL - sequential from P1)
   uint8_t state_val = (state == 0) ? 0x00 : 0x02;
-
-  uint8_t cmd[20] = {
-      0x17, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x09, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x06, 0x46, 0x52, 0x51,
-      0x01, 0x04, state_val, 0x00};
-  cmd[19] = calc_checksum(cmd, 20);
-  send_i2c_message(cmd, 20);
-  ESP_LOGI(TAG, "Sent P2 state=%d command (val=0x%02X) [EXPERIMENTAL]", state, state_val);
+  uint8_t cmd[Pump2Write::LEN];
+  Pump2Write::fill(state_val, cmd);
+  queue_command(CommandTarget::PUMP2, cmd, Pump2Write::LEN, state != 0);
+  ESP_LOGI(TAG, "Queued P2 state=%d command (val=0x%02X) [EXPERIMENTAL]", state, state_val);
 }
 
 void GeckoSpa::send_pump3_command(uint8_t state) {
-  // P3 function ID: 0x05 (EXPERIMENTAL - sequential from P1)
   uint8_t state_val = (state == 0) ? 0x00 : 0x02;
-
-  uint8_t cmd[20] = {
-      0x17, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x09, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x06, 0x46, 0x52, 0x51,
-      0x01, 0x05, state_val, 0x00};
-  cmd[19] = calc_checksum(cmd, 20);
-  send_i2c_message(cmd, 20);
-  ESP_LOGI(TAG, "Sent P3 state=%d command (val=0x%02X) [EXPERIMENTAL]", state, state_val);
+  uint8_t cmd[Pump3Write::LEN];
+  Pump3Write::fill(state_val, cmd);
+  queue_command(CommandTarget::PUMP3, cmd, Pump3Write::LEN, state != 0);
+  ESP_LOGI(TAG, "Queued P3 state=%d command (val=0x%02X) [EXPERIMENTAL]", state, state_val);
 }
 
 void GeckoSpa::send_pump4_command(uint8_t state) {
-  // P4 function ID: 0x06 (EXPERIMENTAL - sequential from P1)
   uint8_t state_val = (state == 0) ? 0x00 : 0x02;
-
-  uint8_t cmd[20] = {
-      0x17, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x09, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x06, 0x46, 0x52, 0x51,
-      0x01, 0x06, state_val, 0x00};
-  cmd[19] = calc_checksum(cmd, 20);
-  send_i2c_message(cmd, 20);
-  ESP_LOGI(TAG, "Sent P4 state=%d command (val=0x%02X) [EXPERIMENTAL]", state, state_val);
+  uint8_t cmd[Pump4Write::LEN];
+  Pump4Write::fill(state_val, cmd);
+  queue_command(CommandTarget::PUMP4, cmd, Pump4Write::LEN, state != 0);
+  ESP_LOGI(TAG, "Queued P4 state=%d command (val=0x%02X) [EXPERIMENTAL]", state, state_val);
 }
 
-
 void GeckoSpa::send_program_command(uint8_t prog) {
   if (prog > 4)
     return;
-  uint8_t cmd[18] = {
-      0x17, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x09, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x04, 0x4E, 0x03, 0xD0,
-      prog, 0x00};
-  cmd[17] = calc_checksum(cmd, 18);
-  send_i2c_message(cmd, 18);
-  ESP_LOGI(TAG, "Sent program %d command", prog);
+  uint8_t cmd[MAX_COMMAND_FRAME];
+  uint8_t len = build_program_frame(prog, cmd);
+  queue_command(CommandTarget::PROGRAM, cmd, len, prog);
+  ESP_LOGI(TAG, "Queued program %d command", prog);
 }
 
 void GeckoSpa::send_temperature_command(float temp_c) {
   if (temp_c < 26.0 || temp_c > 40.0)
     return;
-  uint8_t temp_raw = (uint8_t)((temp_c * 18.0) - 512.0);
-  uint8_t cmd[21] = {
-      0x17, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x09, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x07, 0x46, 0x52, 0x51,
-      0x00, 0x01, 0x02, temp_raw, 0x00};
-  cmd[20] = calc_checksum(cmd, 21);
-  send_i2c_message(cmd, 21);
-  ESP_LOGI(TAG, "Sent temperature %.1f command (raw=%02X)", temp_c, temp_raw);
+  uint16_t temp_raw = temp_c * 18.0f;
+  uint8_t cmd[SetpointWrite::LEN];
+  SetpointWrite::fill(temp_raw, cmd);
+  // Confirmed by the config setpoint word (the status one drops in economy mode)
+  queue_command(CommandTarget::SETPOINT, cmd, SetpointWrite::LEN, temp_raw);
+  ESP_LOGI(TAG, "Queued temperature %.1f command (raw=%04X)", temp_c, temp_raw);
+}
+
+const FieldDesc *GeckoSpa::find_writable_field(uint16_t pos, uint8_t width) const {
+  const FieldDesc *table = config_layout_->fields;
+  size_t count = (size_t) ConfigField::COUNT;
+  if (pos >= LOG_MSG_BASE) {
+    table = status_layout_->fields;
+    count = (size_t) LogField::COUNT;
+  }
+  for (size_t i = 0; i < count; i++) {
+    if (table[i].pos == pos && table[i].writable && table[i].type != FieldType::NONE &&
+        field_width(table[i]) == width)
+      return &table[i];
+  }
+  return nullptr;
+}
+
+bool GeckoSpa::queue_write(uint16_t pos, uint8_t width, uint16_t value) {
+  const FieldDesc *field = find_writable_field(pos, width);
+  if (field == nullptr) {
+    ESP_LOGW(TAG, "No writable %d-byte field at position %d", width, pos);
+    return false;
+  }
+  // A newer write to the same position replaces the pending one, other positions queue up
+  PendingCommand *slot = find_write(pos);
+  for (size_t i = (size_t) CommandTarget::WRITE; slot == nullptr && i < (size_t) CommandTarget::COUNT; i++) {
+    if (commands_[i].len == 0)
+      slot = &commands_[i];
+  }
+  if (slot == nullptr) {
+    ESP_LOGW(TAG, "Write %s@%d refused, %d writes already pending", field->name, pos, WRITE_SLOTS);
+    return false;
+  }
+  uint8_t cmd[MAX_COMMAND_FRAME];
+  uint8_t len = build_write_frame(pos, width, value, cmd);
+  queue_command((CommandTarget) (slot - commands_), cmd, len, value);
+  ESP_LOGI(TAG, "Queued write %s@%d = %d", field->name, pos, value);
+  return true;
+}
+
+// Pending write to a struct position, nullptr if there is none
+PendingCommand *GeckoSpa::find_write(uint16_t pos) {
+  for (size_t i = (size_t) CommandTarget::WRITE; i < (size_t) CommandTarget::COUNT; i++) {
+    if (commands_[i].len != 0 && write_frame_pos(commands_[i].frame) == pos)
+      return &commands_[i];
+  }
+  return nullptr;
+}
+
+bool GeckoSpa::write_value(uint16_t pos, FieldType type, float value) {
+  if (type == FieldType::TEMP)
+    value *= 18.0f;
+  if (value < 0 || value > (type >= FieldType::WORD ? 0xFFFF : 0xFF)) {
+    ESP_LOGW(TAG, "Value %.1f out of range for position %d", value, pos);
+    return false;
+  }
+  return queue_write(pos, type >= FieldType::WORD ? 2 : 1, lroundf(value));
+}
+
+void GeckoSpa::queue_command(CommandTarget target, const uint8_t *frame, uint8_t len, uint16_t expected) {
+  PendingCommand &cmd = commands_[(size_t) target];
+  if (cmd.len != 0)
+    ESP_LOGD(TAG, "Pending %s command superseded", command_name((size_t) target));
+  memcpy(cmd.frame, frame, len);
+  cmd.len = len;
+  cmd.expected = expected;
+  cmd.queued_at = millis();
+  cmd.attempts = 0;
+}
+
+void GeckoSpa::service_commands() {
+  uint32_t now = millis();
+  if (now - last_tx_time_ < COMMAND_PACING_MS)
+    return;
+
+  // Send at most one command per pacing interval: new commands first, then retries
+  PendingCommand *next = nullptr;
+  for (size_t i = 0; i < (size_t) CommandTarget::COUNT; i++) {
+    PendingCommand &cmd = commands_[i];
+    if (cmd.len == 0)
+      continue;
+    if (cmd.attempts >= COMMAND_MAX_ATTEMPTS) {
+      if (now - cmd.sent_at >= COMMAND_RETRY_MS) {
+        ESP_LOGW(TAG, "%s command not confirmed after %d attempts", command_name(i), cmd.attempts);
+        cmd.len = 0;
+        // Undo the optimistic climate target if the setpoint never took
+        if (i == (size_t) CommandTarget::SETPOINT)
+          mark_dirty(PublishEntity::CLIMATE);
+      }
+      continue;
+    }
+    if (cmd.attempts == 0) {
+      next = &cmd;
+      break;
+    }
+    if (next == nullptr && now - cmd.sent_at >= COMMAND_RETRY_MS)
+      next = &cmd;
+  }
+  if (next == nullptr)
+    return;
+
+  if (next->attempts > 0)
+    ESP_LOGD(TAG, "Resending %s command (attempt %d)", command_name(next - commands_), next->attempts + 1);
+  send_i2c_message(next->frame, next->len);
+  next->sent_at = now;
+  next->attempts++;
+}
+
+void GeckoSpa::confirm_command(CommandTarget target, uint16_t observed) {
+  PendingCommand &cmd = commands_[(size_t) target];
+  if (cmd.len == 0 || cmd.attempts == 0 || observed != cmd.expected)
+    return;
+  ESP_LOGD(TAG, "%s command confirmed after %" PRIu32 " ms (%d attempts)", command_name((size_t) target),
+           millis() - cmd.queued_at, cmd.attempts);
+  stats_.command_latency.add(millis() - cmd.queued_at);
+  cmd.len = 0;
+}
+
+void GeckoSpa::dump_trace() {
+  trace_.dump();
+}
+
+void GeckoSpa::start_capture() {
+  if (!link_v2_) {
+    ESP_LOGW(TAG, "Bus capture needs the binary proxy link");
+    return;
+  }
+  if (!trace_.enabled()) {
+    ESP_LOGW(TAG, "Bus capture needs the trace buffer (trace_buffer_size: 0)");
+    return;
+  }
+  trace_.clear();
+  write_str("CAPTURE:1\n");
+}
+
+void GeckoSpa::stop_capture() {
+  write_str("CAPTURE:0\n");
 }
 
 void GeckoSpa::request_status() {
@@ -180,22 +566,34 @@ void GeckoSpa::reset_arduino() {
   reset_in_progress_ = true;
 }
 
-uint8_t GeckoSpa::calc_checksum(const uint8_t *data, uint8_t len) {
-  uint8_t xor_val = 0;
-  for (uint8_t i = 0; i < len - 1; i++) {
-    xor_val ^= data[i];
+void GeckoSpa::send_i2c_message(const uint8_t *data, uint8_t len) {
+  if (len > MAX_COMMAND_FRAME) {
+    ESP_LOGE(TAG, "Refusing %d-byte command frame", len);
+    return;
+  }
+  uint32_t now = millis();
+  last_tx_time_ = now;
+  trace_.record(now, LINK_FRAME_TX, data, len);
+  if (link_v2_) {
+    uint8_t frame[link_encoded_size(MAX_COMMAND_FRAME)];
+    size_t frame_len = link_encode_frame(LINK_FRAME_TX, data, len, frame);
+    write_array(frame, frame_len);
+    return;
   }
-  return xor_val;
-}
 
-void GeckoSpa::send_i2c_message(const uint8_t *data, uint8_t len) {
-  write_str("TX:");
+  // V1: "TX:<hex>\n", built in one buffer and written with a single call
+  static const char HEX_DIGITS[] = "0123456789ABCDEF";
+  char line[3 + MAX_COMMAND_FRAME * 2 + 1];
+  size_t pos = 0;
+  line[pos++] = 'T';
+  line[pos++] = 'X';
+  line[pos++] = ':';
   for (uint8_t i = 0; i < len; i++) {
-    char hex[3];
-    sprintf(hex, "%02X", data[i]);
-    write_str(hex);
+    line[pos++] = HEX_DIGITS[data[i] >> 4];
+    line[pos++] = HEX_DIGITS[data[i] & 0x0F];
   }
-  write_str("\n");
+  line[pos++] = '\n';
+  write_array((const uint8_t *) line, pos);
 }
 
 uint8_t GeckoSpa::hex_to_byte(char high, char low) {
@@ -212,9 +610,11 @@ uint8_t GeckoSpa::hex_to_byte(char high, char low) {
 }
 
 void GeckoSpa::process_proxy_message(const char *msg) {
+#ifdef GECKO_SPA_VERBOSE_LOG
   ESP_LOGD(TAG, "Proxy: %s", msg);
+#endif
 
-  // RX:<len>:<hex>
+  // RX:<len>:<hex> (loop() decodes these while receiving, this handles complete lines)
   if (strncmp(msg, "RX:", 3) == 0) {
     const char *p = msg + 3;
     int len = atoi(p);
@@ -224,39 +624,341 @@ void GeckoSpa::process_proxy_message(const char *msg) {
       p++;
     if (*p == ':')
       p++;
+    if (len > MAX_FRAME_LEN || (int) strlen(p) < len * 2) {
+      ESP_LOGW(TAG, "Malformed RX line");
+      stats_.frame_errors++;
+      return;
+    }
 
-    // Decode hex to bytes
-    uint8_t data[128];
-    for (int i = 0; i < len && i < 128; i++) {
+    // Decode hex into the spare tail of the message buffer
+    uint8_t *data = rx_arena_ + rx_msg_len_;
+    for (int i = 0; i < len; i++) {
       data[i] = hex_to_byte(p[i * 2], p[i * 2 + 1]);
     }
 
     process_i2c_message(data, len);
   } else if (strcmp(msg, "READY") == 0) {
     ESP_LOGI(TAG, "Arduino proxy ready");
+    configure_proxy();
+    go_pending_ = true;  // Start the handshake now rather than at the next keep-alive
   } else if (strcmp(msg, "I2C_PROXY:V1") == 0) {
+    // Printed first on every proxy boot, and a freshly booted proxy is back in its defaults
     ESP_LOGI(TAG, "Arduino proxy version 1");
-  } else if (strcmp(msg, "TX:OK") == 0) {
+    if (capturing_)
+      ESP_LOGW(TAG, "Proxy restarted, bus capture ended");
+    link_v2_ = false;
+    proxy_acks_ = false;
+    capturing_ = false;
+  } else if (strcmp(msg, "I2C_PROXY:V2") == 0) {
+    ESP_LOGI(TAG, "Arduino proxy supports binary link (V2)");
+  } else if (strcmp(msg, "ACK:ON") == 0) {
+    ESP_LOGI(TAG, "Proxy acknowledges handshake messages itself");
+    proxy_acks_ = true;
+  } else if (strcmp(msg, "ACK:OFF") == 0) {
+    ESP_LOGD(TAG, "Proxy leaves handshake acknowledgement to the ESP");
+    proxy_acks_ = false;
+  } else if (strncmp(msg, "ACK:DROP:", 9) == 0) {
+    // ACK:DROP:<total>, the proxy's transmit queue was full of ACKs already
+    stats_.tx_errors++;
+    ESP_LOGW(TAG, "Proxy dropped a handshake ACK (%s since proxy boot)", msg + 9);
+  } else if (strcmp(msg, "MODE:V2") == 0) {
+    ESP_LOGI(TAG, "Proxy link switched to binary framing (V2)");
+    link_v2_ = true;
+    // Reassembled messages need the binary link, so only ask for them now
+    if (proxy_dedup_)
+      write_str("DEDUP:1\n");
+  } else if (strcmp(msg, "DEDUP:ON") == 0) {
+    ESP_LOGI(TAG, "Proxy reassembles multi-part messages and suppresses duplicates");
+  } else if (strcmp(msg, "DEDUP:OFF") == 0) {
+    ESP_LOGD(TAG, "Proxy forwards multi-part messages as received");
+  } else if (strcmp(msg, "CAPTURE:ON") == 0) {
+    ESP_LOGI(TAG, "Proxy bus capture started");
+    capturing_ = true;
+  } else if (strcmp(msg, "CAPTURE:OFF") == 0) {
+    if (capturing_) {
+      ESP_LOGI(TAG, "Proxy bus capture stopped");
+      capturing_ = false;
+      dump_trace();
+    }
+  } else if (strcmp(msg, "MODE:V1") == 0) {
+    ESP_LOGI(TAG, "Proxy link switched to hex lines (V1)");
+    link_v2_ = false;
+  } else if (strncmp(msg, "TX:OK", 5) == 0) {
+    // TX:OK:<latency_us>, older proxies print a bare TX:OK
+    if (msg[5] == ':')
+      stats_.tx_latency.add(strtoul(msg + 6, nullptr, 10));
     ESP_LOGD(TAG, "I2C TX acknowledged");
+  } else if (strncmp(msg, "TX:ERR:", 7) == 0) {
+    // TX:ERR:<reason>[:<latency_us>]; the command is resent if the spa never confirms it
+    stats_.tx_errors++;
+    ESP_LOGW(TAG, "Proxy I2C transmit failed: %s", msg + 7);
   } else if (strcmp(msg, "PONG") == 0) {
     ESP_LOGD(TAG, "Proxy ping OK");
+  } else if (strncmp(msg, "OVF:", 4) == 0) {
+    // OVF:<ring overflows>:<oversize frames>, totals since proxy boot
+    char *end;
+    uint16_t overflows = strtoul(msg + 4, &end, 10);
+    uint16_t oversize = (*end == ':') ? strtoul(end + 1, nullptr, 10) : 0;
+    ESP_LOGW(TAG, "Proxy dropped I2C frames: %u ring overflows (+%u), %u oversize (+%u)",
+             overflows, (uint16_t) (overflows - proxy_ring_overflows_),
+             oversize, (uint16_t) (oversize - proxy_oversize_drops_));
+    proxy_ring_overflows_ = overflows;
+    proxy_oversize_drops_ = oversize;
   }
 }
 
-void GeckoSpa::process_i2c_message(const uint8_t *data, uint8_t len) {
-  // Any I2C message means we're connected
+static int8_t hex_value(uint8_t c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  return -1;
+}
+
+void GeckoSpa::receive_bytes(const uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    uint8_t c = data[i];
+
+    if (c == LINK_DELIMITER) {
+      // Closing delimiter of a non-empty frame, otherwise an opening one
+      if (rx_state_ == RxState::FRAME && rx_encoded_ > 0) {
+        finish_link_frame();
+        rx_state_ = RxState::LINE;
+      } else {
+        rx_state_ = RxState::FRAME;
+        rx_encoded_ = 0;
+        rx_pos_ = 0;
+        cobs_left_ = 0;
+        cobs_zero_ = false;
+        rx_overflow_ = false;
+        rx_dest_ = nullptr;  // Set once the frame header is complete
+      }
+      line_pos_ = 0;
+      continue;
+    }
+
+    bool eol = (c == '\n' || c == '\r');
+    switch (rx_state_) {
+      case RxState::FRAME:
+        rx_encoded_++;
+        receive_frame_byte(c);
+        break;
+
+      case RxState::LINE: {
+        // Lines go in the arena tail, which is free between frames
+        char *line = (char *) rx_arena_ + rx_msg_len_;
+        if (eol) {
+          if (line_pos_ > 0) {
+            line[line_pos_] = '\0';
+            deliver(QueuedKind::PROXY_LINE, (const uint8_t *) line, line_pos_ + 1);
+            line_pos_ = 0;
+          }
+        } else if (line_pos_ < MAX_PROXY_LINE - 1) {
+          line[line_pos_++] = c;
+          if (line_pos_ == 3 && memcmp(line, "RX:", 3) == 0) {
+            rx_state_ = RxState::RX_LEN;
+            rx_expected_ = 0;
+          }
+        }
+        break;
+      }
+
+      case RxState::RX_LEN:
+        if (c >= '0' && c <= '9' && rx_expected_ <= MAX_FRAME_LEN) {
+          rx_expected_ = rx_expected_ * 10 + (c - '0');
+        } else if (c == ':' && rx_expected_ <= MAX_FRAME_LEN) {
+          begin_rx_payload(rx_msg_len_);
+          rx_nibble_ = 0;
+          rx_state_ = RxState::RX_HEX;
+        } else {
+          ESP_LOGW(TAG, "Malformed RX line");
+          stats_.frame_errors++;
+          rx_state_ = eol ? RxState::LINE : RxState::DISCARD;
+          line_pos_ = 0;
+        }
+        break;
+
+      case RxState::RX_HEX: {
+        if (eol) {
+          finish_rx_line();
+          break;
+        }
+        int8_t v = hex_value(c);
+        if (v < 0 || (rx_nibble_ == 0 && rx_pos_ >= rx_expected_)) {
+          ESP_LOGW(TAG, "Malformed RX line");
+          stats_.frame_errors++;
+          rx_state_ = RxState::DISCARD;
+          line_pos_ = 0;
+        } else if (rx_nibble_ == 0) {
+          rx_nibble_ = 0x10 | v;
+        } else {
+          rx_dest_[rx_pos_++] = ((rx_nibble_ & 0x0F) << 4) | v;
+          rx_nibble_ = 0;
+        }
+        break;
+      }
+
+      case RxState::DISCARD:
+        if (eol)
+          rx_state_ = RxState::LINE;
+        break;
+    }
+  }
+}
+
+void GeckoSpa::begin_rx_payload(uint16_t offset) {
+  rx_dest_ = rx_arena_ + offset;
+  rx_capacity_ = sizeof(rx_arena_) - offset;
+  rx_pos_ = 0;
+}
+
+void GeckoSpa::finish_rx_line() {
+  rx_state_ = RxState::LINE;
+  line_pos_ = 0;
+  if (rx_pos_ != rx_expected_ || rx_nibble_ != 0) {
+    ESP_LOGW(TAG, "Truncated RX line (%d of %d bytes)", rx_pos_, rx_expected_);
+    stats_.frame_errors++;
+    return;
+  }
+  process_i2c_message(rx_dest_, rx_pos_);
+}
+
+void GeckoSpa::receive_frame_byte(uint8_t c) {
+  if (cobs_left_ == 0) {
+    // COBS code byte: the previous block ended with a zero unless it was a full 254-byte block
+    if (cobs_zero_)
+      store_frame_byte(0);
+    cobs_zero_ = (c != 0xFF);
+    cobs_left_ = c - 1;
+  } else {
+    store_frame_byte(c);
+    cobs_left_--;
+  }
+}
+
+void GeckoSpa::store_frame_byte(uint8_t c) {
+  if (rx_dest_ == nullptr) {
+    rx_header_[rx_pos_++] = c;
+    // Reassembled messages replace the buffer, single frames go after the partial message
+    if (rx_pos_ == sizeof(rx_header_))
+      begin_rx_payload(rx_header_[0] == LINK_FRAME_MSG ? 0 : rx_msg_len_);
+    return;
+  }
+  if (rx_pos_ < rx_capacity_)
+    rx_dest_[rx_pos_++] = c;
+  else
+    rx_overflow_ = true;
+}
+
+void GeckoSpa::finish_link_frame() {
+  // Once the header is complete rx_pos_ counts payload and CRC bytes
+  uint16_t payload_len = rx_pos_ - 1;
+  uint16_t declared = rx_header_[1] | (rx_header_[2] << 8);
+  if (rx_overflow_ || rx_dest_ == nullptr || rx_pos_ == 0 || cobs_left_ != 0 ||
+      rx_encoded_ < LINK_FRAME_OVERHEAD || declared != payload_len ||
+      link_crc8(rx_dest_, payload_len, link_crc8(rx_header_, sizeof(rx_header_))) != rx_dest_[payload_len]) {
+    ESP_LOGW(TAG, "Dropped corrupt proxy frame (%d bytes)", rx_encoded_);
+    if (rx_overflow_)
+      stats_.buffer_overflows++;
+    else
+      stats_.frame_errors++;
+    return;
+  }
+  process_link_frame(rx_header_[0], rx_dest_, payload_len);
+}
+
+void GeckoSpa::process_link_frame(uint8_t type, const uint8_t *payload, uint16_t payload_len) {
+  if (type == LINK_FRAME_RX) {
+    if (payload_len > MAX_FRAME_LEN) {
+      ESP_LOGW(TAG, "Dropped oversized RX frame (%d bytes)", payload_len);
+      stats_.buffer_overflows++;
+      return;
+    }
+    process_i2c_message(payload, payload_len);
+  } else if (type == LINK_FRAME_MSG) {
+    // Multi-part message already reassembled by the proxy (headers stripped). The proxy
+    // checks each part's checksum and length first and forwards invalid ones as 'R' frames.
+    if (payload_len > MAX_MESSAGE_LEN) {
+      ESP_LOGW(TAG, "Dropped oversized reassembled message (%d bytes)", payload_len);
+      stats_.buffer_overflows++;
+      return;
+    }
+    abort_message(false);
+    note_spa_traffic();
+    trace_.record(last_i2c_time_, LINK_FRAME_MSG, payload, payload_len);
+    deliver(QueuedKind::MESSAGE, payload, payload_len);
+  } else if (type == LINK_FRAME_CAPTURE) {
+    if (payload_len < CAPTURE_HEADER_LEN || payload_len > CAPTURE_HEADER_LEN + MAX_FRAME_LEN) {
+      ESP_LOGW(TAG, "Dropped malformed capture frame (%d bytes)", payload_len);
+      stats_.frame_errors++;
+      return;
+    }
+    trace_.record(millis(), LINK_FRAME_CAPTURE, payload, payload_len);
+    // Received frames are handled as usual, transmit attempts are only recorded
+    if (payload[0] == CAPTURE_EVENT_RX)
+      process_i2c_message(payload + CAPTURE_HEADER_LEN, payload_len - CAPTURE_HEADER_LEN, true);
+  } else {
+    ESP_LOGD(TAG, "Ignoring proxy frame type 0x%02X", type);
+  }
+}
+
+void GeckoSpa::note_spa_traffic() {
   last_i2c_time_ = millis();
+  stats_.window_frames++;
+}
+
+void GeckoSpa::mark_connected() {
+  // Any I2C message means we're connected
   if (!connected_) {
     connected_ = true;
     if (connected_sensor_)
       connected_sensor_->publish_state(true);
     ESP_LOGI(TAG, "Spa connected (I2C traffic detected)");
   }
+}
 
+// Spa messages told apart by process_i2c_message. Parts of multi-part messages are
+// reassembled as they arrive; everything else is one I2C frame.
+enum class SpaFrame : uint8_t { GO, XML, CLOCK, LO, NOTIFICATION, PROGRAM, PART, OTHER };
+
+// Multi-part header is SPA_PART_HEADER_LEN (16) bytes: [0-13]=protocol header +
+// [14-15]=5251("RQ" frame marker). Stripping it aligns payload with geckolib struct offsets.
+
+static SpaFrame classify_frame(const uint8_t *data, uint8_t len) {
+  if (len == 15 && data[13] == 0x47 && data[14] == 0x4F)  // Ends with "GO"
+    return SpaFrame::GO;
+  if (len == 33)  // Config file message with an XML filename
+    return SpaFrame::XML;
+  if (len == 22 && data[13] == 0x4B)  // 0x4B = 'K'
+    return SpaFrame::CLOCK;
+  if (len == 15 && data[13] == 0x4C && data[14] == 0x4F)  // Ends with "LO"
+    return SpaFrame::LO;
+  if (len == 77 && data[6] == 0x0B)
+    return SpaFrame::NOTIFICATION;
+  if (len == 18)
+    return SpaFrame::PROGRAM;
+  // Only concatenate messages with byte[1]=0x09 (config/status type)
+  if (len >= SPA_PART_HEADER_LEN && data[1] == 0x09)
+    return SpaFrame::PART;
+  return SpaFrame::OTHER;
+}
+
+// Runs where the UART is read (loop() or the receive task): acknowledges the handshake
+// and reassembles multi-part messages, then hands complete messages on
+// traced: already in the trace buffer as a capture event
+void GeckoSpa::process_i2c_message(const uint8_t *data, uint8_t len, bool traced) {
+  note_spa_traffic();
+
+  if (!traced)
+    trace_.record(last_i2c_time_, LINK_FRAME_RX, data, len);
+
+#ifdef GECKO_SPA_VERBOSE_LOG
   // Log standalone messages as FULL-RX (not continuation parts of multi-part messages)
   // Continuation flag is byte[9]: 0x01 = more coming
   bool is_continuation = (len >= 10 && data[9] == 0x01);
-  if (!is_continuation && msg_buffer_len_ == 0 && len > 0) {
+  if (!is_continuation && rx_msg_len_ == 0 && len > 0) {
     // Split into 32 bytes per line (64 hex characters)
     const int CHUNK_BYTES = 32;
     char hex_str[68];
@@ -270,467 +972,747 @@ void GeckoSpa::process_i2c_message(const uint8_t *data, uint8_t len) {
       ESP_LOGI(TAG, "  %03d: %s", offset, hex_str);
     }
   }
-
-  // GO message (15 bytes, ends with "GO") - just log it
-  if (len == 15 && data[13] == 0x47 && data[14] == 0x4F) {
-    ESP_LOGD(TAG, "Received GO message from spa");
+#endif
+
+  SpaFrame frame = classify_frame(data, len);
+
+  // Everything but the fixed GO and LO tokens ends in an XOR checksum. Check it before
+  // anything is ACKed or decoded, so a corrupt frame costs one pass over its bytes.
+  if (frame != SpaFrame::GO && frame != SpaFrame::LO &&
+      (len < 2 || frame_checksum(data, len - 1) != data[len - 1])) {
+    ESP_LOGW(TAG, "Dropped %d-byte frame with bad checksum", len);
+    stats_.checksum_errors++;
+    if (frame == SpaFrame::PART)
+      abort_message(data[9] == 0x01);
     return;
   }
 
-  // Handshake acknowledgment response
-  static const uint8_t ACK_MESSAGE[15] = {
-      0x17, 0x0A, 0x00, 0x00, 0x00, 0x17, 0x09, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02
-  };
+  // The spa waits for the XML and clock ACKs, so send them before anything is decoded
+  if ((frame == SpaFrame::XML || frame == SpaFrame::CLOCK) && !proxy_acks_)
+    send_i2c_message(AckFrame::BYTES.data(), AckFrame::LEN);
 
-  // 33-byte config file message - parse XML filename and send acknowledgment
-  if (len == 33) {
-    // Extract XML filename from bytes 16-28 (null-terminated string)
-    char xml_name[16];
-    int pos = 0;
-    for (int i = 16; i < 29 && data[i] != 0 && pos < 15; i++) {
-      xml_name[pos++] = (char)data[i];
-    }
-    xml_name[pos] = '\0';
-
-    ESP_LOGI(TAG, "Handshake XML: %s", xml_name);
-
-    // Parse version number from filename (e.g., inYT_C82.xml -> 82)
-    // Look for _C or _S followed by digits
-    const char *ver_ptr = strstr(xml_name, "_C");
-    if (ver_ptr == nullptr) ver_ptr = strstr(xml_name, "_S");
-    if (ver_ptr != nullptr) {
-      int version = atoi(ver_ptr + 2);
-
-      // Publish to appropriate sensor and store version
-      if (strstr(xml_name, "_C") != nullptr) {
-        config_version_ = version;
-        if (config_version_sensor_)
-          config_version_sensor_->publish_state(xml_name);
-        ESP_LOGI(TAG, "Config version: %d", config_version_);
-      } else if (strstr(xml_name, "_S") != nullptr) {
-        status_version_ = version;
-        if (status_version_sensor_)
-          status_version_sensor_->publish_state(xml_name);
-        ESP_LOGI(TAG, "Status version: %d", status_version_);
-
-        // Select appropriate offsets based on status version
-        if (status_version_ <= 50) {
-          log_offsets_ = &GECKO_LOG_OFFSETS_V50;
-          ESP_LOGI(TAG, "Using v50 log offsets");
-        } else {
-          log_offsets_ = &GECKO_LOG_OFFSETS_V51;
-          ESP_LOGI(TAG, "Using v51+ log offsets");
-        }
-      }
-    }
-
-    send_i2c_message(ACK_MESSAGE, 15);
+  if (frame != SpaFrame::PART) {
+    deliver(QueuedKind::FRAME, data, len);
     return;
   }
 
-  // 22-byte clock message - parse time and send acknowledgment
-  if (len == 22 && data[13] == 0x4B) {  // 0x4B = 'K'
-    // Time format: [15]=Day [16]=Month [17]=DayOfWeek [18]=Hour [19]=Min [20]=Sec
-    uint8_t day = data[15];
-    uint8_t month = data[16];
-    uint8_t hour = data[18];
-    uint8_t minute = data[19];
-    uint8_t second = data[20];
-
-    ESP_LOGD(TAG, "Spa clock: %02d/%02d %02d:%02d:%02d", day, month, hour, minute, second);
-
-    if (spa_time_sensor_) {
-      char time_str[20];
-      snprintf(time_str, sizeof(time_str), "%02d/%02d %02d:%02d:%02d", day, month, hour, minute, second);
-      spa_time_sensor_->publish_state(time_str);
+  // Multi-part message handling using byte[9] as continuation flag
+  // byte[9] == 0x01: more parts coming, byte[9] == 0x00: last part
+  bool more_coming = (data[9] == 0x01);
+  stats_.count(FrameKind::PART);
+
+  // A partial message whose next part didn't follow straight away will never complete
+  if ((rx_msg_len_ != 0 || rx_msg_discard_) && last_i2c_time_ - last_part_time_ > PART_TIMEOUT_MS) {
+    if (rx_msg_len_ != 0) {
+      ESP_LOGW(TAG, "Discarded stale %d-byte partial message", rx_msg_len_);
+      stats_.reassembly_timeouts++;
     }
+    rx_msg_len_ = 0;
+    rx_msg_discard_ = false;
+  }
+  last_part_time_ = last_i2c_time_;
 
-    send_i2c_message(ACK_MESSAGE, 15);
+  if (rx_msg_discard_) {
+    // Rest of an aborted message, up to and including its last part
+    rx_msg_discard_ = more_coming;
     return;
   }
 
-  // 15-byte "LO" message - handshake complete
-  if (len == 15 && data[13] == 0x4C && data[14] == 0x4F) {
-    ESP_LOGI(TAG, "Received LO message - handshake complete");
+  // Every part but the last is full, so a short one means parts went missing
+  int payload_start = SPA_PART_HEADER_LEN;
+  int payload_len = len - payload_start;
+  if (more_coming && len != SPA_MAX_FRAME) {
+    ESP_LOGW(TAG, "Short %d-byte part before the last one, parts missing", len);
+    stats_.sequence_errors++;
+    abort_message(more_coming);
     return;
   }
-
-  // Notification message (77 bytes with byte[6]=0x0B)
-  if (len == 77 && data[6] == 0x0B) {
-    ESP_LOGD(TAG, "77-byte notification message");
-    parse_notification_message(data);
+  if (rx_msg_len_ + payload_len > MAX_MESSAGE_LEN) {
+    ESP_LOGW(TAG, "Message longer than %d bytes, dropped", MAX_MESSAGE_LEN);
+    stats_.buffer_overflows++;
+    abort_message(more_coming);
     return;
   }
 
-  // Program status (18 bytes)
-  if (len == 18) {
-    ESP_LOGI(TAG, "18-byte msg: [1]=%02X [16]=%02X", data[1], data[16]);
-    uint8_t prog = data[16];
-    if (prog <= 4 && prog != program_id_) {
-      program_id_ = prog;
-      ESP_LOGI(TAG, "Program from spa: %d", prog);
-      if (program_select_) {
-        static const char *prog_names[] = {"Away", "Standard", "Energy", "Super Energy", "Weekend"};
-        program_select_->publish_state(prog_names[prog]);
-      }
-    }
+  // Add this part to buffer (strip 16-byte header including frame marker). The part
+  // may already sit in the buffer tail, so the copy can overlap.
+  memmove(rx_arena_ + rx_msg_len_, data + payload_start, payload_len);
+  rx_msg_len_ += payload_len;
+
+  if (more_coming) {
+    ESP_LOGD(TAG, "Message part (%d bytes), more coming. Buffer now %d bytes", len, rx_msg_len_);
     return;
   }
 
-  // Multi-part message handling using byte[9] as continuation flag
-  // byte[9] == 0x01: more parts coming, byte[9] == 0x00: last part
-  // Header is 16 bytes: [0-13]=protocol header + [14-15]=5251("RQ" frame marker)
-  // Stripping 16 bytes aligns payload with geckolib struct offsets
-  // Only concatenate messages with byte[1]=0x09 (config/status type)
-  static const int HEADER_LEN = 16;
+  deliver(QueuedKind::MESSAGE, rx_arena_, rx_msg_len_);
+  // Reset buffer for next message
+  rx_msg_len_ = 0;
+}
 
-  if (len >= HEADER_LEN && data[1] == 0x09) {
-    bool more_coming = (data[9] == 0x01);
+// Drop the message being reassembled, and its remaining parts if more are coming
+void GeckoSpa::abort_message(bool more_coming) {
+  if (rx_msg_len_ != 0)
+    ESP_LOGD(TAG, "Discarding %d bytes of partial message", rx_msg_len_);
+  rx_msg_len_ = 0;
+  rx_msg_discard_ = more_coming;
+  last_part_time_ = last_i2c_time_;
+}
 
-    // Add this part to buffer (strip 16-byte header including frame marker)
-    int payload_start = HEADER_LEN;
-    int payload_len = len - payload_start;
-    if (msg_buffer_len_ + payload_len <= sizeof(msg_buffer_)) {
-      memcpy(msg_buffer_ + msg_buffer_len_, data + payload_start, payload_len);
-      msg_buffer_len_ += payload_len;
-    }
+// Decodes and publishes a single-frame spa message, on loop()
+void GeckoSpa::handle_spa_frame(const uint8_t *data, uint8_t len) {
+  mark_connected();
+
+  switch (classify_frame(data, len)) {
+    case SpaFrame::GO:
+      // GO message from the spa - just log it
+      ESP_LOGD(TAG, "Received GO message from spa");
+      stats_.count(FrameKind::HANDSHAKE);
+      break;
+
+    case SpaFrame::XML: {
+      // 33-byte config file message - parse XML filename (acknowledged on receipt)
+      stats_.count(FrameKind::HANDSHAKE);
+      // Extract XML filename from bytes 16-28 (null-terminated string)
+      char xml_name[16];
+      int pos = 0;
+      for (int i = 16; i < 29 && data[i] != 0 && pos < 15; i++) {
+        xml_name[pos++] = (char)data[i];
+      }
+      xml_name[pos] = '\0';
 
-    if (more_coming) {
-      ESP_LOGD(TAG, "Message part (%d bytes), more coming. Buffer now %d bytes", len, msg_buffer_len_);
-      return;
+      ESP_LOGI(TAG, "Handshake XML: %s", xml_name);
+      apply_xml_name(xml_name);
+      // Config XML comes first, the status XML is the last one before the clock
+      set_handshake_state(strstr(xml_name, "_S") != nullptr ? HandshakeState::WAIT_CLOCK : HandshakeState::WAIT_XML);
+      break;
     }
 
-    // Last part received - log complete message in FULL-RX format
-    // Split into 32 bytes per line (64 hex characters)
-    const int CHUNK_BYTES = 32;
-    char hex_str[68];
-    int total_bytes = msg_buffer_len_;
-    ESP_LOGI(TAG, "FULL-RX:%d bytes", total_bytes);
-    for (int offset = 0; offset < total_bytes; offset += CHUNK_BYTES) {
-      int chunk_len = (total_bytes - offset < CHUNK_BYTES) ? (total_bytes - offset) : CHUNK_BYTES;
-      int pos = 0;
-      for (int i = 0; i < chunk_len; i++) {
-        pos += sprintf(hex_str + pos, "%02X", msg_buffer_[offset + i]);
+    case SpaFrame::CLOCK: {
+      // 22-byte clock message - parse time (acknowledged on receipt)
+      stats_.count(FrameKind::HANDSHAKE);
+      // Time format: [15]=Day [16]=Month [17]=DayOfWeek [18]=Hour [19]=Min [20]=Sec
+      uint8_t day = data[15];
+      uint8_t month = data[16];
+      uint8_t hour = data[18];
+      uint8_t minute = data[19];
+      uint8_t second = data[20];
+
+      ESP_LOGD(TAG, "Spa clock: %02d/%02d %02d:%02d:%02d", day, month, hour, minute, second);
+      set_handshake_state(HandshakeState::WAIT_LO);
+
+      if (spa_time_sensor_) {
+        char time_str[20];
+        snprintf(time_str, sizeof(time_str), "%02d/%02d %02d:%02d:%02d", day, month, hour, minute, second);
+        spa_time_sensor_->publish_state(time_str);
       }
-      ESP_LOGI(TAG, "  %03d: %s", offset, hex_str);
+      break;
     }
 
-    // Check message type by size
-    // ~162 bytes = status-only message (3 parts: 78+78+54 - 3*16 headers)
-    // ~390 bytes = config+status message (8 parts with log section starting at offset 230)
-
-    // We expect status message to be around 150 bytes long, but it varies per spa pack model
-    // and software version.  The length will be consistent per pack, so once we've detected
-    // it we can assume that all future messages at that length are status messages.  Assume
-    // that anything between MIN_STATUS_MSG_LEN and 170 bytes long, with a 0 byte at offset 1,
-    // is a status message if we don't yet know the correct length.
-    if (status_msg_len_ == 0) {
-      if ((msg_buffer_len_ >= MIN_STATUS_MSG_LEN) &&
-          (msg_buffer_len_ <= 170) &&
-          (msg_buffer_[1] == 0x00)) {
-        ESP_LOGI(TAG, "Auto-detect %d as the standard status message length", msg_buffer_len_);
-        status_msg_len_ = msg_buffer_len_;
+    case SpaFrame::LO:
+      // 15-byte "LO" message - handshake complete
+      ESP_LOGI(TAG, "Received LO message - handshake complete");
+      stats_.count(FrameKind::HANDSHAKE);
+      set_handshake_state(HandshakeState::COMPLETE);
+      break;
+
+    case SpaFrame::NOTIFICATION:
+      // Notification message (77 bytes with byte[6]=0x0B)
+      ESP_LOGD(TAG, "77-byte notification message");
+      stats_.count(FrameKind::NOTIFICATION);
+      parse_notification_message(data);
+      break;
+
+    case SpaFrame::PROGRAM: {
+      // Program status (18 bytes)
+      stats_.count(FrameKind::PROGRAM);
+#ifdef GECKO_SPA_VERBOSE_LOG
+      ESP_LOGI(TAG, "18-byte msg: [1]=%02X [16]=%02X", data[1], data[16]);
+#endif
+      uint8_t prog = data[16];
+      confirm_command(CommandTarget::PROGRAM, prog);
+      if (prog <= 4 && prog != program_id_) {
+        program_id_ = prog;
+        ESP_LOGI(TAG, "Program from spa: %d", prog);
+        if (program_select_) {
+          static const char *prog_names[] = {"Away", "Standard", "Energy", "Super Energy", "Weekend"};
+          program_select_->publish_state(prog_names[prog]);
+        }
       }
+      break;
     }
 
-    // Check message type by size
-    // 162 bytes = status-only message (3 parts: 78+78+54 - 3*16 headers)
-    // ~390 bytes = config+status message (8 parts with log section starting at offset 230)
-    if ((msg_buffer_len_ == status_msg_len_) &&
-        (status_msg_len_ != 0) &&
-        (msg_buffer_[1] == 0x00)) {
-      // Status-only message (162 bytes)
-      ESP_LOGI(TAG, "Status msg (%db): [3]=%02X [5]=%02X [21-24]=%02X%02X%02X%02X [53]=%02X",
-               msg_buffer_len_,
-               msg_buffer_[3], msg_buffer_[5],
-               msg_buffer_[21], msg_buffer_[22], msg_buffer_[23], msg_buffer_[24], msg_buffer_[53]);
-      parse_status_message(msg_buffer_);
-    } else if (msg_buffer_len_ >= 300 && msg_buffer_len_ <= 400) {
-      // Config+status message (~390 bytes)
-      // Config section has +2 byte offset (geckolib offset N → message byte N+2)
-      static const int CFG_OFFSET = 2;  // Config struct offset
-
-      // Parse config section (with +2 offset from geckolib struct definitions)
-      // Geckolib offsets → message bytes: N → N+2
-      uint8_t config_num = msg_buffer_[CFG_OFFSET + 0];
-      uint16_t setpoint_raw = (msg_buffer_[CFG_OFFSET + 1] << 8) | msg_buffer_[CFG_OFFSET + 2];
-      float setpoint_c = setpoint_raw / 18.0f;
-      uint8_t filt_freq = msg_buffer_[CFG_OFFSET + 3];
-      uint8_t temp_units = msg_buffer_[CFG_OFFSET + 33];  // 0=F, 1=C
-      uint8_t time_format = msg_buffer_[CFG_OFFSET + 34]; // 0=NA, 1=AmPm, 2=24h
-      uint8_t pump_timeout = msg_buffer_[CFG_OFFSET + 54];
-      uint8_t light_timeout = msg_buffer_[CFG_OFFSET + 55];
-      uint8_t econ_type = msg_buffer_[CFG_OFFSET + 70];   // 0=Standard, 1=Night
-      uint8_t customer_id = msg_buffer_[CFG_OFFSET + 111];
-      uint8_t num_zones = msg_buffer_[CFG_OFFSET + 127];
-      uint8_t silent_mode = msg_buffer_[CFG_OFFSET + 157]; // 0=NA, 1=OFF, 2=ECONOMY, 3=SLEEP, 4=NIGHT
-
-      static const char* time_fmt_str[] = {"NA", "AmPm", "24h"};
-      static const char* silent_str[] = {"NA", "OFF", "ECONOMY", "SLEEP", "NIGHT"};
-      static const char* econ_str[] = {"Standard", "Night"};
-
-      ESP_LOGI(TAG, "Config: Ver=%d Setpoint=%.1f%s FiltFreq=%d TimeFormat=%s",
-               config_num, setpoint_c, temp_units == 1 ? "C" : "F", filt_freq,
-               time_format < 3 ? time_fmt_str[time_format] : "?");
-      ESP_LOGI(TAG, "Config: PumpTimeout=%dmin LightTimeout=%dmin EconType=%s",
-               pump_timeout, light_timeout,
-               econ_type < 2 ? econ_str[econ_type] : "?");
-      ESP_LOGI(TAG, "Config: CustomerID=%d Zones=%d SilentMode=%s",
-               customer_id, num_zones,
-               silent_mode < 5 ? silent_str[silent_mode] : "?");
-
-      // Reuse the status parser on the status portion, if we know what the length of the
-      // status message should be.
-      if (status_msg_len_ != 0) {
-        // Status portion is the very end of the message
-        int STATUS_OFFSET = msg_buffer_len_ - status_msg_len_;
-        // Check for some expected byte markers
-        if ((msg_buffer_[STATUS_OFFSET - 1] == 0x3B) &&
-            (msg_buffer_[STATUS_OFFSET + 1] == 0)) {
-          parse_status_message(&msg_buffer_[STATUS_OFFSET]);
+    default:
+      stats_.count(FrameKind::OTHER);
+
+#ifdef GECKO_SPA_VERBOSE_LOG
+      // Short messages (< 11 bytes) - log them
+      if (len > 2) {
+        char hex_str[64];
+        int pos = 0;
+        for (int i = 0; i < len && pos < 60; i++) {
+          pos += sprintf(hex_str + pos, "%02X", data[i]);
         }
+        ESP_LOGI(TAG, "Short msg (%d bytes): %s", len, hex_str);
       }
+#endif
+      break;
+  }
+}
+
+// Decodes and publishes a reassembled message, on loop()
+void GeckoSpa::process_reassembled_message(const uint8_t *msg, uint16_t msg_len) {
+  mark_connected();
+
+#ifdef GECKO_SPA_VERBOSE_LOG
+  // Log complete message in FULL-RX format
+  // Split into 32 bytes per line (64 hex characters)
+  const int CHUNK_BYTES = 32;
+  char hex_str[68];
+  int total_bytes = msg_len;
+  ESP_LOGI(TAG, "FULL-RX:%d bytes", total_bytes);
+  for (int offset = 0; offset < total_bytes; offset += CHUNK_BYTES) {
+    int chunk_len = (total_bytes - offset < CHUNK_BYTES) ? (total_bytes - offset) : CHUNK_BYTES;
+    int pos = 0;
+    for (int i = 0; i < chunk_len; i++) {
+      pos += sprintf(hex_str + pos, "%02X", msg[offset + i]);
     }
+    ESP_LOGI(TAG, "  %03d: %s", offset, hex_str);
+  }
+#endif
+
+  // We expect status message to be around 150 bytes long, but it varies per spa pack model
+  // and software version.  Unless the status layout gave the length, detect it once: it
+  // is consistent per pack, so all future messages at that length are status messages.
+  if (status_msg_len_ == 0 && looks_like_status(msg, msg_len)) {
+    ESP_LOGI(TAG, "Auto-detect %d as the standard status message length", msg_len);
+    status_msg_len_ = msg_len;
+  }
+
+  // Check message type by size (see message_layout.h)
+  MessageKind kind = classify_message(msg, msg_len, status_msg_len_);
+  if (kind == MessageKind::STATUS) {
+    // Status-only message (162 bytes)
+#ifdef GECKO_SPA_VERBOSE_LOG
+    ESP_LOGI(TAG, "Status msg (%db): [3]=%02X [5]=%02X [21-24]=%02X%02X%02X%02X [53]=%02X",
+             msg_len,
+             msg[3], msg[5],
+             msg[21], msg[22], msg[23], msg[24], msg[53]);
+#endif
+    stats_.count(FrameKind::STATUS);
+    parse_status_message(msg, msg_len);
+  } else if (kind == MessageKind::CONFIG) {
+    // Config+status message (~390 bytes)
+    stats_.count(FrameKind::CONFIG);
+    // Config runs up to the status portion at the end; only the bytes the field table
+    // covers matter, which also keeps status changes out of the config checksum
+    uint16_t config_offset = config_layout_->offset;
+    parse_config_message(msg + config_offset,
+                         config_section_len(msg_len, status_msg_len_, config_layout_->len, config_offset));
+
+    // Reuse the status parser on the status portion, if we know what the length of the
+    // status message should be.
+    if (status_msg_len_ != 0) {
+      uint16_t status_offset = config_status_offset(msg, msg_len, status_msg_len_, config_offset);
+      if (status_offset != 0) {
+        parse_status_message(msg + status_offset, status_msg_len_);
+      } else {
+        stats_.reassembly_errors++;
+      }
+    }
+  } else if (status_msg_len_ != 0) {
+    ESP_LOGD(TAG, "Unrecognised %d-byte message", msg_len);
+    stats_.reassembly_errors++;
+  }
+}
 
-    // Reset buffer for next message
-    msg_buffer_len_ = 0;
+// FNV-1a hash of the config section, to detect changes
+static uint32_t config_checksum(const uint8_t *data, uint16_t len) {
+  uint32_t hash = 2166136261u;
+  for (uint16_t i = 0; i < len; i++)
+    hash = (hash ^ data[i]) * 16777619u;
+  return hash;
+}
+
+void GeckoSpa::parse_config_message(const uint8_t *data, uint16_t len) {
+  confirm_write(data, len, 0);
+  // The status setpoint (RealSetPointG) is lowered in economy mode, so the setpoint
+  // command is confirmed here like a write
+  confirm_command(CommandTarget::SETPOINT,
+                  decode_field(config_layout_->fields[(size_t) ConfigField::SetpointG], data, len, 0));
+  uint32_t checksum = config_checksum(data, len);
+  if (config_received_ && checksum == config_checksum_)
     return;
+  config_received_ = true;
+  config_checksum_ = checksum;
+  ESP_LOGD(TAG, "Config changed (%d bytes), decoding", len);
+
+  auto value = [&](ConfigField id) { return decode_field(config_layout_->fields[(size_t) id], data, len, 0); };
+
+#ifdef GECKO_SPA_VERBOSE_LOG
+  auto name = [&](ConfigField id) { return field_value_name(config_layout_->fields[(size_t) id], value(id)); };
+  ESP_LOGI(TAG, "Config: Ver=%d Setpoint=%.1f%s FiltFreq=%d TimeFormat=%s",
+           (int) value(ConfigField::ConfigNumber), value(ConfigField::SetpointG) / 18.0f,
+           name(ConfigField::TempUnits), (int) value(ConfigField::FiltFreq), name(ConfigField::TimeFormat));
+  ESP_LOGI(TAG, "Config: PumpTimeout=%dmin LightTimeout=%dmin EconType=%s",
+           (int) value(ConfigField::PumpTimeOut), (int) value(ConfigField::LightTimeOut),
+           name(ConfigField::EconType));
+  ESP_LOGI(TAG, "Config: CustomerID=%s Zones=%s SilentMode=%s",
+           name(ConfigField::CustomerID), name(ConfigField::NumberOfZones), name(ConfigField::SilentMode));
+#endif
+
+  for (const ConfigEntity &entity : config_entities_) {
+    const FieldDesc &f = config_layout_->fields[(size_t) entity.field];
+    int32_t v = value(entity.field);
+    if (v == FIELD_UNAVAILABLE)
+      continue;
+    if (entity.sensor) {
+      // Temperatures in degC, times of day and durations in minutes
+      float state = v;
+      if (f.type == FieldType::TEMP)
+        state = v / 18.0f;
+      else if (f.type == FieldType::TIME)
+        state = (v >> 8) * 60 + (v & 0xFF);
+      entity.sensor->publish_state(state);
+    }
+    if (entity.text_sensor) {
+      char text[12];
+      if (f.type == FieldType::ENUM) {
+        entity.text_sensor->publish_state(field_value_name(f, v));
+        continue;
+      }
+      if (f.type == FieldType::TIME)
+        snprintf(text, sizeof(text), "%02d:%02d", (int) (v >> 8), (int) (v & 0xFF));
+      else if (f.type == FieldType::TEMP)
+        snprintf(text, sizeof(text), "%.1f", v / 18.0f);
+      else
+        snprintf(text, sizeof(text), "%d", (int) v);
+      entity.text_sensor->publish_state(text);
+    }
   }
+}
 
-  // Short messages (< 11 bytes) - log them
-  if (len > 2) {
-    char hex_str[64];
-    int pos = 0;
-    for (int i = 0; i < len && pos < 60; i++) {
-      pos += sprintf(hex_str + pos, "%02X", data[i]);
-    }
-    ESP_LOGI(TAG, "Short msg (%d bytes): %s", len, hex_str);
-  }
-}
-
-void GeckoSpa::parse_status_message(const uint8_t *data) {
-  // Convert geckolib offset to message byte: byte = geckolib_offset - 254
-  // This accounts for the +2 byte misalignment between geckolib structs and actual message
-  auto toB = [](uint16_t geckoOffset) -> uint16_t { return geckoOffset - 254; };
-
-  // Get offsets from version-specific struct
-  const GeckoLogOffsets &off = *log_offsets_;
-
-  // Calculate message byte positions
-  uint16_t b_hours = toB(off.hours);
-  uint16_t b_quietState = toB(off.quietState);
-  uint16_t b_udP1 = toB(off.udP1);
-  uint16_t b_deviceStatus = toB(off.deviceStatus);
-  uint16_t b_p1 = toB(off.p1);
-  uint16_t b_udLi = toB(off.udLi);
-  uint16_t b_realSetPoint = toB(off.realSetPointG);
-  uint16_t b_displayedTemp = toB(off.displayedTempG);
-  uint16_t b_lockMode = toB(off.lockMode);
-  uint16_t b_packType = toB(off.packType);
-  uint16_t b_udPumpTime = toB(off.udPumpTime);
-
-  // === Decode all fields from geckolib-compatible offsets ===
-
-  // Hours counter
-  uint8_t hours = data[b_hours];
-
-  // QuietState: 0=NOT_SET, 1=DRAIN, 2=SOAK, 3=OFF
-  uint8_t quietState = data[b_quietState];
-  static const char* quiet_str[] = {"NOT_SET", "DRAIN", "SOAK", "OFF"};
-
-  // User demand P1-P4 (2-bit fields in UdP1 byte)
-  uint8_t udP1_raw = data[b_udP1];
-  uint8_t udP1 = (udP1_raw >> 0) & 0x03;  // bits 0-1
-  uint8_t udP2 = (udP1_raw >> 2) & 0x03;  // bits 2-3
-  uint8_t udP3 = (udP1_raw >> 4) & 0x03;  // bits 4-5
-  uint8_t udP4 = (udP1_raw >> 6) & 0x03;  // bits 6-7
-  static const char* pump_ud_str[] = {"OFF", "LO", "HI", "?"};
-
-  // Device status byte (CP, BL, Heater, Waterfall)
-  uint8_t devStatus = data[b_deviceStatus];
-  bool cp_on = (devStatus >> 2) & 0x01;      // bit 2: CP (circulation pump)
-  bool bl_on = (devStatus >> 1) & 0x01;      // bit 1: BL (blower)
-  bool heater_on = (devStatus >> 5) & 0x01;  // bit 5: MSTR_HEATER
-  bool waterfall = (devStatus >> 7) & 0x01;  // bit 7: Waterfall
-
-  // P1-P4 device status (2-bit fields)
-  uint8_t p1_raw = data[b_p1];
-  uint8_t p1_state = (p1_raw >> 0) & 0x03;  // bits 0-1: 0=OFF, 1=HIGH, 2=LOW
-  uint8_t p2_state = (p1_raw >> 2) & 0x03;  // bits 2-3
-  uint8_t p3_state = (p1_raw >> 4) & 0x03;  // bits 4-5
-  uint8_t p4_state = (p1_raw >> 6) & 0x03;  // bits 6-7
-  static const char* pump_state_str[] = {"OFF", "HIGH", "LOW", "?"};
-
-  // Light user demand
-  uint8_t udLi = data[b_udLi];
-
-  // Lock mode: 0=UNLOCK, 1=PARTIAL, 2=FULL
-  uint8_t lockMode = data[b_lockMode];
-  static const char* lock_str[] = {"UNLOCK", "PARTIAL", "FULL"};
-
-  // Pack type
-  uint8_t packType = data[b_packType];
-  static const char* pack_str[] = {"Unknown", "inXE", "MasIBC", "MIA", "DJS4", "inClear", "inXM", "K600", "inTerface", "inTouch", "inYT"};
-
-  // Pump timer countdown
-  uint8_t pumpTime = data[b_udPumpTime];
-
-  // Temperature (word values, big-endian)
-  uint16_t target_raw = (data[b_realSetPoint] << 8) | data[b_realSetPoint + 1];
-  uint16_t actual_raw = (data[b_displayedTemp] << 8) | data[b_displayedTemp + 1];
-  float target_temp = target_raw / 18.0f;
-  float actual_temp = actual_raw / 18.0f;
+// Bitmap of the 4-byte words that differ between two payloads of len bytes
+static uint64_t changed_words(const uint8_t *a, const uint8_t *b, uint16_t len) {
+  uint64_t changed = 0;
+  for (uint16_t i = 0, w = 0; i < len; i += 4, w++) {
+    uint32_t wa = 0, wb = 0;
+    uint16_t n = (len - i) < 4 ? (len - i) : 4;
+    memcpy(&wa, a + i, n);
+    memcpy(&wb, b + i, n);
+    if (wa != wb)
+      changed |= 1ULL << w;
+  }
+  return changed;
+}
+
+// True if any byte of the field lies in a changed word
+static bool field_changed(const FieldDesc &f, uint16_t base, uint64_t changed) {
+  if (f.type == FieldType::NONE || f.pos < base)
+    return false;
+  uint16_t first = (f.pos - base) / 4;
+  uint16_t last = (f.pos - base + field_width(f) - 1) / 4;
+  for (uint16_t w = first; w <= last && w < 64; w++) {
+    if (changed & (1ULL << w))
+      return true;
+  }
+  return false;
+}
+
+void GeckoSpa::confirm_status_commands() {
+  auto value = [&](LogField id) -> uint16_t {
+    int32_t v = log_value(id);
+    return v == FIELD_UNAVAILABLE ? 0 : (uint16_t) v;
+  };
+
+  // Clear queued commands the spa has now applied
+  confirm_command(CommandTarget::LIGHT, value(LogField::UdLi) != 0);
+  confirm_command(CommandTarget::CIRC, value(LogField::CP));
+  confirm_command(CommandTarget::PUMP1, value(LogField::P1) != 0);
+  confirm_command(CommandTarget::PUMP2, value(LogField::P2) != 0);
+  confirm_command(CommandTarget::PUMP3, value(LogField::P3) != 0);
+  confirm_command(CommandTarget::PUMP4, value(LogField::P4) != 0);
+}
+
+// Confirm pending write_field() commands once a message shows the written value at their
+// position
+void GeckoSpa::confirm_write(const uint8_t *data, uint16_t len, uint16_t base) {
+  for (size_t i = (size_t) CommandTarget::WRITE; i < (size_t) CommandTarget::COUNT; i++) {
+    const PendingCommand &cmd = commands_[i];
+    if (cmd.len == 0)
+      continue;
+    uint16_t pos = write_frame_pos(cmd.frame);
+    uint8_t width = write_frame_width(cmd.frame);
+    if (pos < base || pos - base + width > len)
+      continue;
+    const uint8_t *p = data + (pos - base);
+    confirm_command((CommandTarget) i, width == 2 ? (p[0] << 8) | p[1] : p[0]);
+  }
+}
+
+// Record the config or status XML name from the handshake (or a snapshot) and select the
+// layout for its pack and version
+void GeckoSpa::apply_xml_name(const char *xml_name) {
+  // Parse pack, kind and version from the filename (e.g., inYT_C82.xml -> inYT, C, 82)
+  size_t pack_len;
+  char kind;
+  uint8_t version;
+  if (!parse_xml_name(xml_name, &pack_len, &kind, &version)) {
+    if (xml_name[0] != '\0')  // Snapshots taken before the handshake have none
+      ESP_LOGW(TAG, "Unrecognised XML name %s", xml_name);
+    return;
+  }
+  bool exact = false;
+  const MessageLayout *layout = find_layout(MESSAGE_LAYOUTS, xml_name, &exact);
+  if (layout == nullptr) {
+    ESP_LOGW(TAG, "No layout for %s, keeping the current one", xml_name);
+  } else if (!exact) {
+    ESP_LOGW(TAG, "No %.*s layout for %s, using %s v%d-%d", (int) pack_len, xml_name, xml_name, layout->pack,
+             layout->min_version, layout->max_version);
+  }
+
+  // Publish to appropriate sensor and store version
+  if (kind == 'C') {
+    config_version_ = version;
+    if (strncmp(config_xml_, xml_name, sizeof(config_xml_))) {
+      strncpy(config_xml_, xml_name, sizeof(config_xml_) - 1);
+      snapshot_dirty_ = true;
+    }
+    if (config_version_sensor_)
+      config_version_sensor_->publish_state(xml_name);
+    ESP_LOGI(TAG, "Config version: %d", config_version_);
+    if (layout != nullptr && layout != config_layout_) {
+      config_layout_ = layout;
+      config_received_ = false;  // Decode the next config with the new table
+    }
+  } else {
+    status_version_ = version;
+    if (strncmp(status_xml_, xml_name, sizeof(status_xml_))) {
+      strncpy(status_xml_, xml_name, sizeof(status_xml_) - 1);
+      snapshot_dirty_ = true;
+    }
+    if (status_version_sensor_)
+      status_version_sensor_->publish_state(xml_name);
+    ESP_LOGI(TAG, "Status version: %d", status_version_);
+
+    if (layout != nullptr) {
+      status_layout_ = layout;
+      ESP_LOGI(TAG, "Using %s v%d-%d status layout", layout->pack, layout->min_version, layout->max_version);
+      // A known length saves detecting it, and holds even before any status arrives
+      if (exact && layout->len != 0 && layout->len != status_msg_len_) {
+        status_msg_len_ = layout->len;
+        ESP_LOGI(TAG, "Status message length %d from the layout", status_msg_len_);
+      }
+    }
+    last_status_len_ = 0;  // Force a full decode with the new table
+  }
+}
+
+void GeckoSpa::parse_status_message(const uint8_t *data, uint16_t len) {
+  if (len > MAX_STATUS_MSG_LEN) {
+    ESP_LOGW(TAG, "Status message too long (%d bytes)", len);
+    return;
+  }
+
+  // Live data replaces whatever was restored from the snapshot
+  if (snapshot_stale_) {
+    snapshot_stale_ = false;
+    if (stale_sensor_)
+      stale_sensor_->publish_state(false);
+    ESP_LOGI(TAG, "Live status received, snapshot values confirmed");
+  }
+
+  uint32_t now = millis();
+  if (stats_.last_status_time != 0)
+    stats_.status_interval.add(now - stats_.last_status_time);
+  stats_.last_status_time = now;
+  if (metering_)
+    update_meter(now);
+
+  // The spa repeats the same status payload most of the time. Diff it word-wise against the
+  // previous one: skip identical payloads and only decode fields whose bytes changed.
+  bool first = !first_status_received_;
+  bool full = first || len != last_status_len_;
+  uint64_t changed = full ? ~0ULL : changed_words(last_status_, data, len);
+  auto updated = [&](LogField id) {
+    return full || field_changed(status_layout_->fields[(size_t) id], status_layout_->base, changed);
+  };
+  uint16_t changed_fields = 0;
+  if (changed != 0) {
+    for (size_t i = 0; i < (size_t) LogField::COUNT; i++) {
+      if (updated((LogField) i))
+        changed_fields++;
+    }
+    memcpy(last_status_, data, len);
+    last_status_len_ = len;
+  }
+
+  // A repeated payload can still confirm a command that asked for the current state
+  confirm_status_commands();
+  confirm_write(data, len, status_layout_->base);
+  if (changed_fields == 0)
+    return;
+  snapshot_dirty_ = true;
+  ESP_LOGD(TAG, "Status: %d field(s) changed", changed_fields);
+
+  auto value = [&](LogField id) -> uint16_t {
+    int32_t v = log_value(id);
+    return v == FIELD_UNAVAILABLE ? 0 : (uint16_t) v;
+  };
 
   // === Log decoded status (geckolib format) ===
+#ifdef GECKO_SPA_VERBOSE_LOG
   ESP_LOGI(TAG, "Status[v%d]: Hours=%d QuietState=%s LockMode=%s PackType=%s",
-           status_version_, hours,
-           quietState < 4 ? quiet_str[quietState] : "?",
-           lockMode < 3 ? lock_str[lockMode] : "?",
-           packType < 11 ? pack_str[packType] : "?");
+           status_version_, value(LogField::Hours),
+           log_value_name(LogField::QuietState), log_value_name(LogField::LockMode),
+           log_value_name(LogField::PackType));
 
   ESP_LOGI(TAG, "Status: Temp=%.1f/%.1f°C Heater=%s CP=%s BL=%s Waterfall=%s",
-           target_temp, actual_temp,
-           heater_on ? "ON" : "OFF",
-           cp_on ? "ON" : "OFF",
-           bl_on ? "ON" : "OFF",
-           waterfall ? "ON" : "OFF");
+           value(LogField::RealSetPointG) / 18.0f, value(LogField::DisplayedTempG) / 18.0f,
+           value(LogField::MSTR_HEATER) ? "ON" : "OFF",
+           value(LogField::CP) ? "ON" : "OFF",
+           value(LogField::BL) ? "ON" : "OFF",
+           value(LogField::Waterfall) ? "ON" : "OFF");
 
   ESP_LOGI(TAG, "Status: P1=%s P2=%s P3=%s P4=%s PumpTimer=%dmin",
-           pump_state_str[p1_state], pump_state_str[p2_state],
-           pump_state_str[p3_state], pump_state_str[p4_state],
-           pumpTime);
+           log_value_name(LogField::P1), log_value_name(LogField::P2),
+           log_value_name(LogField::P3), log_value_name(LogField::P4),
+           value(LogField::UdPumpTime));
 
   ESP_LOGI(TAG, "Status: UdP1=%s UdP2=%s UdP3=%s UdP4=%s UdLi=%s",
-           pump_ud_str[udP1], pump_ud_str[udP2],
-           pump_ud_str[udP3], pump_ud_str[udP4],
-           udLi ? "ON" : "OFF");
+           log_value_name(LogField::UdP1), log_value_name(LogField::UdP2),
+           log_value_name(LogField::UdP3), log_value_name(LogField::UdP4),
+           value(LogField::UdLi) ? "ON" : "OFF");
+#endif
 
   // === Update internal state and entities ===
 
-  // Derive states for Home Assistant entities
-  bool new_standby = (quietState == 0x03);  // OFF in QuietState means standby
-  bool new_circ = cp_on;              // Circulation pump from device status (CP)
-  bool new_waterfall = waterfall;     // Waterfall from device status
-  bool new_blower = bl_on;            // Blower from device status (BL)
-  bool new_heating = heater_on;       // Heater from device status
-  bool new_light = (udLi != 0);       // Light from UdLi (user demand light)
-
-  // P1-P4 individual pump states (0=OFF, 1=HIGH, 2=LOW)
-  uint8_t new_p1 = p1_state;
-  uint8_t new_p2 = p2_state;
-  uint8_t new_p3 = p3_state;
-  uint8_t new_p4 = p4_state;
-
-  float new_target = target_temp;
-  float new_actual = actual_temp;
-  bool temp_valid = (target_raw != 0 || actual_raw != 0);
-
   // On first status message, publish all states
-  bool first = !first_status_received_;
   if (first) {
     first_status_received_ = true;
     ESP_LOGI(TAG, "First status received, publishing all states");
   }
 
-  // Update entities on change (or first message)
-  if (first || new_light != light_state_) {
-    light_state_ = new_light;
-    ESP_LOGI(TAG, "Light: %s", light_state_ ? "ON" : "OFF");
-    if (light_switch_)
-      light_switch_->publish_state(light_state_);
+  // Each entity's fields are only decoded when their bytes changed (all of them on the
+  // first message). Changed entities are marked; loop() publishes them.
+  if (updated(LogField::UdLi)) {
+    bool new_light = value(LogField::UdLi) != 0;  // Light from UdLi (user demand light)
+    if (first || new_light != light_state_) {
+      light_state_ = new_light;
+      ESP_LOGI(TAG, "Light: %s", light_state_ ? "ON" : "OFF");
+      mark_dirty(PublishEntity::LIGHT);
+    }
   }
 
-  if (first || new_circ != circ_state_) {
-    circ_state_ = new_circ;
-    ESP_LOGI(TAG, "Circulation: %s", circ_state_ ? "ON" : "OFF");
-    if (circ_switch_)
-      circ_switch_->publish_state(circ_state_);
+  if (updated(LogField::CP)) {
+    bool new_circ = value(LogField::CP);  // Circulation pump from device status (CP)
+    if (first || new_circ != circ_state_) {
+      circ_state_ = new_circ;
+      ESP_LOGI(TAG, "Circulation: %s", circ_state_ ? "ON" : "OFF");
+      mark_dirty(PublishEntity::CIRCULATION);
+    }
   }
 
-  if (first || new_waterfall != waterfall_state_) {
-    waterfall_state_ = new_waterfall;
-    ESP_LOGI(TAG, "Waterfall: %s", waterfall_state_ ? "ON" : "OFF");
-    if (waterfall_sensor_)
-      waterfall_sensor_->publish_state(waterfall_state_);
+  if (updated(LogField::Waterfall)) {
+    bool new_waterfall = value(LogField::Waterfall);
+    if (first || new_waterfall != waterfall_state_) {
+      waterfall_state_ = new_waterfall;
+      ESP_LOGI(TAG, "Waterfall: %s", waterfall_state_ ? "ON" : "OFF");
+      mark_dirty(PublishEntity::WATERFALL);
+    }
   }
 
-  if (first || new_blower != blower_state_) {
-    blower_state_ = new_blower;
-    ESP_LOGI(TAG, "Blower: %s", blower_state_ ? "ON" : "OFF");
-    if (blower_sensor_)
-      blower_sensor_->publish_state(blower_state_);
+  if (updated(LogField::BL)) {
+    bool new_blower = value(LogField::BL);  // Blower from device status (BL)
+    if (first || new_blower != blower_state_) {
+      blower_state_ = new_blower;
+      ESP_LOGI(TAG, "Blower: %s", blower_state_ ? "ON" : "OFF");
+      mark_dirty(PublishEntity::BLOWER);
+    }
   }
 
-  if (first || new_heating != heating_state_) {
-    heating_state_ = new_heating;
-    ESP_LOGI(TAG, "Heating: %s", heating_state_ ? "ON" : "OFF");
-    update_climate_state();
+  if (updated(LogField::MSTR_HEATER)) {
+    bool new_heating = value(LogField::MSTR_HEATER);
+    if (first || new_heating != heating_state_) {
+      heating_state_ = new_heating;
+      ESP_LOGI(TAG, "Heating: %s", heating_state_ ? "ON" : "OFF");
+      mark_dirty(PublishEntity::CLIMATE);
+    }
   }
 
-  if (first || new_standby != standby_state_) {
-    standby_state_ = new_standby;
-    ESP_LOGI(TAG, "Standby: %s", standby_state_ ? "ON" : "OFF");
-    if (standby_sensor_)
-      standby_sensor_->publish_state(standby_state_);
+  if (updated(LogField::QuietState)) {
+    // QuietState 0=NOT_SET, 1=DRAIN, 2=SOAK, 3=OFF; OFF means standby
+    bool new_standby = value(LogField::QuietState) == 0x03;
+    if (first || new_standby != standby_state_) {
+      standby_state_ = new_standby;
+      ESP_LOGI(TAG, "Standby: %s", standby_state_ ? "ON" : "OFF");
+      mark_dirty(PublishEntity::STANDBY);
+    }
   }
 
-  // Update LockMode sensor
-  if (first || lockMode != lock_mode_) {
-    lock_mode_ = lockMode;
-    if (lock_mode_sensor_) {
-      lock_mode_sensor_->publish_state(lockMode < 3 ? lock_str[lockMode] : "?");
+  if (updated(LogField::LockMode)) {
+    uint8_t lockMode = value(LogField::LockMode);  // 0=UNLOCK, 1=PARTIAL, 2=FULL
+    if (first || lockMode != lock_mode_) {
+      lock_mode_ = lockMode;
+      mark_dirty(PublishEntity::LOCK_MODE);
     }
   }
 
-  // Update PackType sensor
-  if (first || packType != pack_type_) {
-    pack_type_ = packType;
-    if (pack_type_sensor_) {
-      pack_type_sensor_->publish_state(packType < 11 ? pack_str[packType] : "?");
+  if (updated(LogField::PackType)) {
+    uint8_t packType = value(LogField::PackType);
+    if (first || packType != pack_type_) {
+      pack_type_ = packType;
+      mark_dirty(PublishEntity::PACK_TYPE);
     }
   }
 
-  // Update PumpTimer sensor
-  if (first || pumpTime != pump_timer_) {
-    pump_timer_ = pumpTime;
-    if (pump_timer_sensor_) {
-      pump_timer_sensor_->publish_state(pumpTime);
+  if (updated(LogField::UdPumpTime)) {
+    uint8_t pumpTime = value(LogField::UdPumpTime);
+    if (first || pumpTime != pump_timer_) {
+      pump_timer_ = pumpTime;
+      mark_dirty(PublishEntity::PUMP_TIMER);
     }
   }
 
-  // Only update temperature if valid data was received
-  if (temp_valid && (first || abs(new_target - target_temp_) > 0.1 || abs(new_actual - actual_temp_) > 0.1)) {
-    target_temp_ = new_target;
-    actual_temp_ = new_actual;
-    ESP_LOGI(TAG, "Temp: target=%.1f actual=%.1f", target_temp_, actual_temp_);
-    update_climate_state();
+  // Temperature (word values, 1/18 degC). Only update it if valid data was received.
+  // Setpoint changes are always published, the current temperature once it moves more
+  // than the hysteresis.
+  if (updated(LogField::RealSetPointG) || updated(LogField::DisplayedTempG)) {
+    uint16_t target_raw = value(LogField::RealSetPointG);
+    uint16_t actual_raw = value(LogField::DisplayedTempG);
+    if (target_raw != 0 || actual_raw != 0) {
+      float new_target = target_raw / 18.0f;
+      float new_actual = actual_raw / 18.0f;
+      bool target_changed = first || new_target != target_temp_;
+      target_temp_ = new_target;
+      actual_temp_ = new_actual;
+      if (target_changed || fabsf(new_actual - published_actual_temp_) > temperature_hysteresis_) {
+        ESP_LOGI(TAG, "Temp: target=%.1f actual=%.1f", target_temp_, actual_temp_);
+        mark_dirty(PublishEntity::CLIMATE);
+      }
+    }
   }
 
-  // Update P1-P4 pump states (all controllable switches)
-  if (first || new_p1 != pump1_state_) {
-    pump1_state_ = new_p1;
-    if (pump1_switch_)
-      pump1_switch_->publish_state(pump1_state_ != 0);
+  // Update P1-P4 pump states (all controllable switches; 0=OFF, 1=HIGH, 2=LOW)
+  if (updated(LogField::P1)) {
+    uint8_t new_p1 = value(LogField::P1);
+    if (first || new_p1 != pump1_state_) {
+      pump1_state_ = new_p1;
+      mark_dirty(PublishEntity::PUMP1);
+    }
   }
-  if (first || new_p2 != pump2_state_) {
-    pump2_state_ = new_p2;
-    if (pump2_switch_)
-      pump2_switch_->publish_state(pump2_state_ != 0);
+  if (updated(LogField::P2)) {
+    uint8_t new_p2 = value(LogField::P2);
+    if (first || new_p2 != pump2_state_) {
+      pump2_state_ = new_p2;
+      mark_dirty(PublishEntity::PUMP2);
+    }
   }
-  if (first || new_p3 != pump3_state_) {
-    pump3_state_ = new_p3;
-    if (pump3_switch_)
-      pump3_switch_->publish_state(pump3_state_ != 0);
+  if (updated(LogField::P3)) {
+    uint8_t new_p3 = value(LogField::P3);
+    if (first || new_p3 != pump3_state_) {
+      pump3_state_ = new_p3;
+      mark_dirty(PublishEntity::PUMP3);
+    }
   }
-  if (first || new_p4 != pump4_state_) {
-    pump4_state_ = new_p4;
-    if (pump4_switch_)
-      pump4_switch_->publish_state(pump4_state_ != 0);
+  if (updated(LogField::P4)) {
+    uint8_t new_p4 = value(LogField::P4);
+    if (first || new_p4 != pump4_state_) {
+      pump4_state_ = new_p4;
+      mark_dirty(PublishEntity::PUMP4);
+    }
+  }
+}
+
+// Publish the entities marked since the last loop(), each at most once per its minimum
+// interval. Entities still inside their interval stay dirty and publish their latest
+// state when it is up, so a burst of changes costs one API message per entity.
+void GeckoSpa::flush_publishes() {
+  if (publish_dirty_ == 0)
+    return;
+  uint32_t now = millis();
+  for (size_t i = 0; i < (size_t) PublishEntity::COUNT; i++) {
+    uint32_t bit = 1u << i;
+    if ((publish_dirty_ & bit) == 0)
+      continue;
+    if ((published_ & bit) != 0 && now - last_publish_[i] < publish_interval_[i])
+      continue;
+    publish_dirty_ &= ~bit;
+    published_ |= bit;
+    last_publish_[i] = now;
+    publish_entity((PublishEntity) i);
+  }
+}
+
+void GeckoSpa::publish_entity(PublishEntity entity) {
+  switch (entity) {
+    case PublishEntity::LIGHT:
+      if (light_switch_)
+        light_switch_->publish_state(light_state_);
+      break;
+    case PublishEntity::CIRCULATION:
+      if (circ_switch_)
+        circ_switch_->publish_state(circ_state_);
+      break;
+    case PublishEntity::PUMP1:
+      if (pump1_switch_)
+        pump1_switch_->publish_state(pump1_state_ != 0);
+      break;
+    case PublishEntity::PUMP2:
+      if (pump2_switch_)
+        pump2_switch_->publish_state(pump2_state_ != 0);
+      break;
+    case PublishEntity::PUMP3:
+      if (pump3_switch_)
+        pump3_switch_->publish_state(pump3_state_ != 0);
+      break;
+    case PublishEntity::PUMP4:
+      if (pump4_switch_)
+        pump4_switch_->publish_state(pump4_state_ != 0);
+      break;
+    case PublishEntity::WATERFALL:
+      if (waterfall_sensor_)
+        waterfall_sensor_->publish_state(waterfall_state_);
+      break;
+    case PublishEntity::BLOWER:
+      if (blower_sensor_)
+        blower_sensor_->publish_state(blower_state_);
+      break;
+    case PublishEntity::STANDBY:
+      if (standby_sensor_)
+        standby_sensor_->publish_state(standby_state_);
+      break;
+    case PublishEntity::LOCK_MODE:
+      if (lock_mode_sensor_)
+        lock_mode_sensor_->publish_state(log_value_name(LogField::LockMode));
+      break;
+    case PublishEntity::PACK_TYPE:
+      if (pack_type_sensor_)
+        pack_type_sensor_->publish_state(log_value_name(LogField::PackType));
+      break;
+    case PublishEntity::PUMP_TIMER:
+      if (pump_timer_sensor_)
+        pump_timer_sensor_->publish_state(pump_timer_);
+      break;
+    case PublishEntity::CLIMATE:
+      update_climate_state();
+      break;
+    case PublishEntity::METERS:
+      for (size_t i = 0; i < (size_t) MeteredDevice::COUNT; i++) {
+        if (runtime_sensors_[i])
+          runtime_sensors_[i]->publish_state(meter_.runtime_hours((MeteredDevice) i));
+        if (energy_sensors_[i])
+          energy_sensors_[i]->publish_state(meter_.energy_kwh((MeteredDevice) i));
+      }
+      if (total_energy_sensor_)
+        total_energy_sensor_->publish_state(meter_.total_energy_kwh());
+      break;
+    default:
+      break;
   }
 }
 
 void GeckoSpa::update_climate_state() {
+  published_actual_temp_ = actual_temp_;
   if (!climate_)
     return;
 
@@ -794,52 +1776,144 @@ void GeckoSpa::parse_notification_message(const uint8_t *data) {
     }
     uint16_t interval = data[offset + 4] | (data[offset + 5] << 8);
 
-    if (id == 0 || interval == 0)
+    if (id == 0 || id > 4 || interval == 0)
       continue;
 
-    // Calculate due date: reset_date + interval days
-    struct tm reset_tm = {};
-    reset_tm.tm_year = 100 + reset_year;  // years since 1900
-    reset_tm.tm_mon = reset_month - 1;     // 0-based month
-    reset_tm.tm_mday = reset_day + interval;  // mktime normalizes this
-    mktime(&reset_tm);  // Normalize the date
-
-    // Format as ISO date string (YYYY-MM-DD)
-    char date_str[12];
-    snprintf(date_str, sizeof(date_str), "%04d-%02d-%02d",
-             1900 + reset_tm.tm_year, reset_tm.tm_mon + 1, reset_tm.tm_mday);
-
-    ESP_LOGI(TAG, "Notification %d: reset=%02d/%02d/%02d interval=%d due=%s",
-             id, reset_day, reset_month, reset_year, interval, date_str);
-
-    text_sensor::TextSensor *sensor = nullptr;
-    switch (id) {
-      case 0x01:
-        sensor = rinse_filter_sensor_;
-        break;
-      case 0x02:
-        sensor = clean_filter_sensor_;
-        break;
-      case 0x03:
-        sensor = change_water_sensor_;
-        break;
-      case 0x04:
-        sensor = spa_checkup_sensor_;
-        break;
-    }
+    // Due date: reset date + interval days, kept as a day number and formatted on publish
+    uint16_t due = days_since_2000(reset_day, reset_month, reset_year) + interval;
+    ESP_LOGI(TAG, "Notification %d: reset=%02d/%02d/%02d interval=%d due=day %d",
+             id, reset_day, reset_month, reset_year, interval, due);
 
     // Publish state if it has changed
-    if (strcmp(date_str, notification_date_[id - 1]))
-    {
-      ESP_LOGI(TAG, "Publish changed notification %d : %s", id, date_str);
-      if (sensor) {
-        sensor->publish_state(date_str);
-      }
-      strcpy(notification_date_[id - 1], date_str);
+    if (due != notification_due_[id - 1]) {
+      notification_due_[id - 1] = due;
+      publish_notification(id - 1);
+      snapshot_dirty_ = true;
     }
   }
 }
 
+// Publish a notification's due date as an ISO date string (YYYY-MM-DD)
+void GeckoSpa::publish_notification(uint8_t index) {
+  struct tm due_tm = {};
+  due_tm.tm_year = 100;                            // 2000
+  due_tm.tm_mday = 1 + notification_due_[index];  // mktime normalizes this
+  mktime(&due_tm);
+
+  char date_str[36];  // Worst case for three int fields
+  snprintf(date_str, sizeof(date_str), "%04d-%02d-%02d",
+           1900 + due_tm.tm_year, due_tm.tm_mon + 1, due_tm.tm_mday);
+  ESP_LOGI(TAG, "Publish notification %d : %s", index + 1, date_str);
+
+  text_sensor::TextSensor *sensor = notification_sensor(index + 1);
+  if (sensor)
+    sensor->publish_state(date_str);
+}
+
+text_sensor::TextSensor *GeckoSpa::notification_sensor(uint8_t id) {
+  switch (id) {
+    case 0x01:
+      return rinse_filter_sensor_;
+    case 0x02:
+      return clean_filter_sensor_;
+    case 0x03:
+      return change_water_sensor_;
+    case 0x04:
+      return spa_checkup_sensor_;
+  }
+  return nullptr;
+}
+
+void GeckoSpa::restore_snapshot() {
+  SpaSnapshot snap;
+  if (!snapshot_pref_.load(&snap))
+    return;
+  if (snap.version != SNAPSHOT_VERSION || snap.status_len < MIN_STATUS_MSG_LEN ||
+      snap.status_len > MAX_STATUS_MSG_LEN) {
+    ESP_LOGW(TAG, "Ignoring incompatible snapshot (version %d, %d bytes)", snap.version, snap.status_len);
+    return;
+  }
+  ESP_LOGI(TAG, "Restoring snapshot: %d-byte status, %s / %s", snap.status_len, snap.config_xml, snap.status_xml);
+
+  snap.config_xml[sizeof(snap.config_xml) - 1] = '\0';
+  snap.status_xml[sizeof(snap.status_xml) - 1] = '\0';
+  apply_xml_name(snap.config_xml);
+  apply_xml_name(snap.status_xml);
+  status_msg_len_ = snap.status_len;
+
+  for (uint8_t i = 0; i < 4; i++) {
+    notification_due_[i] = snap.notification_due[i];
+    if (notification_due_[i] != 0)
+      publish_notification(i);
+  }
+
+  // Decode and publish the stored status as if it had just arrived, then mark it stale
+  parse_status_message(snap.status, snap.status_len);
+  stats_.last_status_time = 0;
+  meter_.restart();  // The restored states are from before the reboot
+  snapshot_stale_ = true;
+  if (stale_sensor_)
+    stale_sensor_->publish_state(true);
+  snapshot_dirty_ = false;
+}
+
+void GeckoSpa::save_snapshot() {
+  last_snapshot_time_ = millis();
+  snapshot_dirty_ = false;
+  // Only a decoded status is worth restoring
+  if (last_status_len_ == 0)
+    return;
+
+  SpaSnapshot snap{};
+  snap.version = SNAPSHOT_VERSION;
+  snap.status_len = last_status_len_;
+  memcpy(snap.config_xml, config_xml_, sizeof(snap.config_xml));
+  memcpy(snap.status_xml, status_xml_, sizeof(snap.status_xml));
+  memcpy(snap.notification_due, notification_due_, sizeof(snap.notification_due));
+  memcpy(snap.status, last_status_, last_status_len_);
+  if (snapshot_pref_.save(&snap))
+    ESP_LOGD(TAG, "Saved snapshot (%d-byte status)", snap.status_len);
+  else
+    ESP_LOGW(TAG, "Failed to save snapshot");
+}
+
+// Count the time since the previous status message for the devices that were on in it,
+// which last_status_ still holds
+void GeckoSpa::update_meter(uint32_t now) {
+  auto on = [&](LogField id) {
+    int32_t v = log_value(id);
+    return v != FIELD_UNAVAILABLE && v != 0;
+  };
+  const bool states[(size_t) MeteredDevice::COUNT] = {on(LogField::MSTR_HEATER), on(LogField::CP), on(LogField::BL),
+                                                      on(LogField::P1), on(LogField::P2), on(LogField::P3),
+                                                      on(LogField::P4)};
+  if (!meter_.update(now, states))
+    return;
+  meter_dirty_ = true;
+  mark_dirty(PublishEntity::METERS);
+}
+
+void GeckoSpa::restore_meter() {
+  MeterTotals totals;
+  if (!meter_pref_.load(&totals))
+    return;
+  if (totals.version != EnergyMeter::VERSION) {
+    ESP_LOGW(TAG, "Ignoring incompatible meter totals (version %d)", totals.version);
+    return;
+  }
+  meter_.totals = totals;
+  ESP_LOGI(TAG, "Restored meter totals: %.3f kWh", meter_.total_energy_kwh());
+}
+
+void GeckoSpa::save_meter() {
+  last_meter_save_ = millis();
+  meter_dirty_ = false;
+  if (meter_pref_.save(&meter_.totals))
+    ESP_LOGD(TAG, "Saved meter totals (%.3f kWh)", meter_.total_energy_kwh());
+  else
+    ESP_LOGW(TAG, "Failed to save meter totals");
+}
+
 // GeckoSpaClimate implementation
 void GeckoSpaClimate::setup() {
   this->mode = climate::CLIMATE_MODE_HEAT;
@@ -871,18 +1945,25 @@ void GeckoSpaClimate::control(const climate::ClimateCall &call) {
 
 // GeckoSpaSwitch implementation
 void GeckoSpaSwitch::write_state(bool state) {
-  if (switch_type_ == "light") {
-    parent_->send_light_command(state);
-  } else if (switch_type_ == "circulation") {
-    parent_->send_circ_command(state);
-  } else if (switch_type_ == "pump1") {
-    parent_->send_pump1_command(state ? 1 : 0);  // 1=HIGH, 0=OFF
-  } else if (switch_type_ == "pump2") {
-    parent_->send_pump2_command(state ? 1 : 0);  // EXPERIMENTAL
-  } else if (switch_type_ == "pump3") {
-    parent_->send_pump3_command(state ? 1 : 0);  // EXPERIMENTAL
-  } else if (switch_type_ == "pump4") {
-    parent_->send_pump4_command(state ? 1 : 0);  // EXPERIMENTAL
+  switch (switch_type_) {
+    case SwitchType::LIGHT:
+      parent_->send_light_command(state);
+      break;
+    case SwitchType::CIRCULATION:
+      parent_->send_circ_command(state);
+      break;
+    case SwitchType::PUMP1:
+      parent_->send_pump1_command(state ? 1 : 0);  // 1=HIGH, 0=OFF
+      break;
+    case SwitchType::PUMP2:
+      parent_->send_pump2_command(state ? 1 : 0);  // EXPERIMENTAL
+      break;
+    case SwitchType::PUMP3:
+      parent_->send_pump3_command(state ? 1 : 0);  // EXPERIMENTAL
+      break;
+    case SwitchType::PUMP4:
+      parent_->send_pump4_command(state ? 1 : 0);  // EXPERIMENTAL
+      break;
   }
   // State will be published when spa confirms the change
 }
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <string>
+#include <type_traits>
+#include <vector>
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/gpio.h"
 #include "esphome/core/preferences.h"
 #include "esphome/components/uart/uart.h"
@@ -12,57 +16,98 @@
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #include "esphome/components/text_sensor/text_sensor.h"
 #include "esphome/components/sensor/sensor.h"
+#include "proxy_link.h"
+#include "command_frame.h"
+#include "energy_meter.h"
+#include "gecko_config_fields.h"
+#include "gecko_layouts.h"
+#include "gecko_log_fields.h"
+#include "link_stats.h"
+#include "message_layout.h"
+#include "message_queue.h"
+#include "trace_buffer.h"
 
 namespace esphome {
 namespace gecko_spa {
 
-// Geckolib-compatible offset structure for log/status messages
-// Offsets are geckolib offsets (base 256), convert to message byte with: byte = offset - 254
-struct GeckoLogOffsets {
-  uint16_t hours;           // Operating hours
-  uint16_t quietState;      // Quiet/drain/soak mode
-  uint16_t udP1;            // User demand P1-P4 (2-bit fields)
-  uint16_t deviceStatus;    // CP, BL, Heater, Waterfall bits
-  uint16_t p1;              // P1-P4 device status (2-bit fields)
-  uint16_t udLi;            // Light user demand
-  uint16_t realSetPointG;   // Target temperature (word)
-  uint16_t displayedTempG;  // Actual temperature (word)
-  uint16_t lockMode;        // Keypad lock status
-  uint16_t packType;        // Pack type identifier
-  uint16_t udPumpTime;      // Pump timer countdown
+class GeckoSpaClimate;
+
+// Pending write_field() commands to different positions, each with a slot of its own
+static const uint8_t WRITE_SLOTS = 4;
+
+// Targets of outbound commands. Each target has one queue slot, so a newer command
+// replaces (coalesces) one that is still pending for the same target. Writes are keyed
+// by position: WRITE + i is the slot of one pending write.
+enum class CommandTarget : uint8_t {
+  LIGHT = 0,
+  CIRC,
+  PUMP1,
+  PUMP2,
+  PUMP3,
+  PUMP4,
+  PROGRAM,
+  SETPOINT,
+  WRITE,  // write_field() / gecko_spa.write, WRITE_SLOTS slots
+  COUNT = WRITE + WRITE_SLOTS
 };
 
-// Default offsets for inYT v51+ (most common)
-static const GeckoLogOffsets GECKO_LOG_OFFSETS_V51 = {
-  .hours = 256,
-  .quietState = 257,
-  .udP1 = 259,
-  .deviceStatus = 260,
-  .p1 = 261,
-  .udLi = 307,
-  .realSetPointG = 275,
-  .displayedTempG = 277,
-  .lockMode = 310,
-  .packType = 289,
-  .udPumpTime = 303,
+// Spa outputs a GeckoSpaSwitch controls
+enum class SwitchType : uint8_t {
+  LIGHT = 0,
+  CIRCULATION,
+  PUMP1,
+  PUMP2,
+  PUMP3,
+  PUMP4,
 };
 
-// Offsets for inYT v50 (older version with shifted offsets)
-static const GeckoLogOffsets GECKO_LOG_OFFSETS_V50 = {
-  .hours = 284,
-  .quietState = 285,
-  .udP1 = 258,
-  .deviceStatus = 259,
-  .p1 = 260,
-  .udLi = 307,
-  .realSetPointG = 274,
-  .displayedTempG = 276,
-  .lockMode = 309,
-  .packType = 288,
-  .udPumpTime = 302,
+// Entities published from status messages. Decoding marks them dirty and loop() publishes
+// each one at most once, with the latest state, when its minimum interval is up.
+enum class PublishEntity : uint8_t {
+  LIGHT = 0,
+  CIRCULATION,
+  PUMP1,
+  PUMP2,
+  PUMP3,
+  PUMP4,
+  WATERFALL,
+  BLOWER,
+  STANDBY,
+  LOCK_MODE,
+  PACK_TYPE,
+  PUMP_TIMER,
+  CLIMATE,  // Heating, target and current temperature
+  METERS,   // Run time and energy sensors
+  COUNT
 };
 
-class GeckoSpaClimate;
+// Queued command, resent until the spa reports the expected state or it times out
+struct PendingCommand {
+  uint8_t frame[MAX_COMMAND_FRAME];
+  uint8_t len{0};          // 0 = slot empty
+  uint16_t expected{0};    // State that confirms the command (on/off, program, raw setpoint)
+  uint32_t queued_at{0};
+  uint32_t sent_at{0};
+  uint8_t attempts{0};
+};
+
+// Handshake the spa runs after a GO: config XML, status XML, clock, then LO. Each step
+// must arrive within HANDSHAKE_STEP_MS of the previous one or the GO is resent.
+enum class HandshakeState : uint8_t {
+  IDLE = 0,    // No GO sent yet
+  WAIT_XML,    // GO sent, waiting for the XML file names
+  WAIT_CLOCK,
+  WAIT_LO,
+  COMPLETE,
+  STALLED,     // HANDSHAKE_MAX_ATTEMPTS GOs in a row went unanswered
+};
+
+// Entity publishing one decoded config field
+struct ConfigEntity {
+  ConfigField field;
+  sensor::Sensor *sensor;
+  text_sensor::TextSensor *text_sensor;
+};
 
 enum class NotifDateFormat : uint8_t {
   Y_M_D = 0,
@@ -73,6 +118,8 @@ class GeckoSpa : public Component, public uart::UARTDevice {
  public:
   void setup() override;
   void loop() override;
+  void dump_config() override;
+  void on_safe_shutdown() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
 
   // Entity setters - switches (controllable)
@@ -94,6 +141,7 @@ class GeckoSpa : public Component, public uart::UARTDevice {
     connected_sensor_ = bs;
     bs->publish_state(connected_);
   }
+  void set_stale_sensor(binary_sensor::BinarySensor *bs) { stale_sensor_ = bs; }
   void set_climate(climate::Climate *cl) { climate_ = cl; }
   void set_rinse_filter_sensor(text_sensor::TextSensor *s) { rinse_filter_sensor_ = s; }
   void set_clean_filter_sensor(text_sensor::TextSensor *s) { clean_filter_sensor_ = s; }
@@ -105,8 +153,32 @@ class GeckoSpa : public Component, public uart::UARTDevice {
   void set_lock_mode_sensor(text_sensor::TextSensor *s) { lock_mode_sensor_ = s; }
   void set_pack_type_sensor(text_sensor::TextSensor *s) { pack_type_sensor_ = s; }
   void set_pump_timer_sensor(sensor::Sensor *s) { pump_timer_sensor_ = s; }
+  void set_metric_sensor(MetricSensor metric, sensor::Sensor *s) { metric_sensors_[(size_t) metric] = s; }
+  void set_frame_counts_sensor(text_sensor::TextSensor *s) { frame_counts_sensor_ = s; }
+  void set_runtime_sensor(MeteredDevice device, sensor::Sensor *s) { runtime_sensors_[(size_t) device] = s; }
+  void set_energy_sensor(MeteredDevice device, sensor::Sensor *s) { energy_sensors_[(size_t) device] = s; }
+  void set_total_energy_sensor(sensor::Sensor *s) { total_energy_sensor_ = s; }
+  void set_handshake_sensor(text_sensor::TextSensor *s) { handshake_sensor_ = s; }
+  // Entity setters - decoded config fields
+  void add_config_sensor(ConfigField field, sensor::Sensor *s) { config_entities_.push_back({field, s, nullptr}); }
+  void add_config_text_sensor(ConfigField field, text_sensor::TextSensor *s) {
+    config_entities_.push_back({field, nullptr, s});
+  }
+  void set_publish_interval(PublishEntity entity, uint32_t interval_ms) {
+    publish_interval_[(size_t) entity] = interval_ms;
+  }
+  void set_temperature_hysteresis(float hysteresis) { temperature_hysteresis_ = hysteresis; }
+  void set_metrics_interval(uint32_t interval_ms) { metrics_interval_ = interval_ms; }
+  void set_snapshot_interval(uint32_t interval_ms) { snapshot_interval_ = interval_ms; }
+  void set_device_power(MeteredDevice device, uint16_t watts) { meter_.power_w[(size_t) device] = watts; }
+  void set_meter_save_interval(uint32_t interval_ms) { meter_save_interval_ = interval_ms; }
   void set_reset_pin(GPIOPin *pin) { reset_pin_ = pin; }
   void set_notif_date_format(NotifDateFormat format) { notif_date_format_ = format; }
+  void set_binary_link(bool enable) { binary_link_ = enable; }
+  void set_proxy_dedup(bool enable) { proxy_dedup_ = enable; }
+  void set_proxy_auto_ack(bool enable) { proxy_auto_ack_ = enable; }
+  void set_trace_buffer_size(uint16_t size) { trace_buffer_size_ = size; }
+  void set_rx_task(bool enable) { rx_task_ = enable; }
 
   // Command methods
   void send_light_command(bool on);
@@ -117,8 +189,26 @@ class GeckoSpa : public Component, public uart::UARTDevice {
   void send_pump4_command(uint8_t state);  // Experimental: func ID 0x06
   void send_program_command(uint8_t prog);
   void send_temperature_command(float temp_c);
+
+  // Write a byte (uint8_t) or big-endian word (uint16_t) to the spa's memory at a struct
+  // position as listed in the generated field tables: config fields below LOG_MSG_BASE,
+  // status fields from there on. Only positions holding a writable field of that width
+  // are accepted. The write is queued, retried and confirmed like the other commands.
+  template<typename T> bool write_field(uint16_t pos, T value) {
+    static_assert(std::is_same<T, uint8_t>::value || std::is_same<T, uint16_t>::value,
+                  "Spa fields are a byte (uint8_t) or a word (uint16_t)");
+    return queue_write(pos, sizeof(T), value);
+  }
+  // Same, with the width given by a field type; TEMP values are in degC
+  bool write_value(uint16_t pos, FieldType type, float value);
   void request_status();
   void reset_arduino();
+  void dump_trace();  // Log the recorded raw I2C frames
+  // Timestamped bus capture by the proxy (binary link only). Starting empties the trace
+  // buffer, and the session is dumped like dump_trace() when the proxy confirms the stop.
+  void start_capture();
+  void stop_capture();
+  const LinkStats &get_link_stats() const { return stats_; }
 
   // State getters
   bool get_light_state() { return light_state_; }
@@ -146,6 +236,7 @@ class GeckoSpa : public Component, public uart::UARTDevice {
   select::Select *program_select_{nullptr};
   binary_sensor::BinarySensor *standby_sensor_{nullptr};
   binary_sensor::BinarySensor *connected_sensor_{nullptr};
+  binary_sensor::BinarySensor *stale_sensor_{nullptr};
   climate::Climate *climate_{nullptr};
   text_sensor::TextSensor *rinse_filter_sensor_{nullptr};
   text_sensor::TextSensor *clean_filter_sensor_{nullptr};
@@ -157,8 +248,22 @@ class GeckoSpa : public Component, public uart::UARTDevice {
   text_sensor::TextSensor *lock_mode_sensor_{nullptr};
   text_sensor::TextSensor *pack_type_sensor_{nullptr};
   sensor::Sensor *pump_timer_sensor_{nullptr};
+  sensor::Sensor *metric_sensors_[(size_t) MetricSensor::COUNT]{};
+  text_sensor::TextSensor *frame_counts_sensor_{nullptr};
+  sensor::Sensor *runtime_sensors_[(size_t) MeteredDevice::COUNT]{};
+  sensor::Sensor *energy_sensors_[(size_t) MeteredDevice::COUNT]{};
+  sensor::Sensor *total_energy_sensor_{nullptr};
+  text_sensor::TextSensor *handshake_sensor_{nullptr};
+  std::vector<ConfigEntity> config_entities_;
   GPIOPin *reset_pin_{nullptr};
   NotifDateFormat notif_date_format_{NotifDateFormat::D_M_Y};
+  bool binary_link_{true};  // Negotiate V2 binary framing if the proxy supports it
+  bool proxy_dedup_{false};  // Let the proxy reassemble and deduplicate (V2 only)
+  bool proxy_auto_ack_{false};  // Let the proxy ACK handshake messages itself
+  uint16_t trace_buffer_size_{4096};  // Bytes of raw frame trace, 0 disables
+  TraceBuffer trace_;
+  LinkStats stats_;
+  uint32_t metrics_interval_{60000};
 
   // State
   bool light_state_{false};
@@ -179,42 +284,210 @@ class GeckoSpa : public Component, public uart::UARTDevice {
   uint8_t program_id_{0xFF};
   float target_temp_{0};
   float actual_temp_{0};
+  float published_actual_temp_{0};  // Current temperature the climate last published
   uint32_t last_i2c_time_{0};
   uint32_t last_go_send_time_{0};
+  std::atomic<uint32_t> last_tx_time_{0};  // Also written by the receive task (handshake ACKs)
   uint32_t reset_start_time_{0};
   bool reset_in_progress_{false};
-  char notification_date_[4][12]{ "", "", "", ""};
+  uint16_t notification_due_[4]{};  // Due dates in days since 2000-01-01, 0 = unknown
 
   // Version tracking (parsed from handshake XML filenames)
   uint8_t config_version_{0};   // e.g., 82 from inYT_C82.xml
   uint8_t status_version_{0};   // e.g., 81 from inYT_S81.xml
-  const GeckoLogOffsets *log_offsets_{&GECKO_LOG_OFFSETS_V51};  // Default to v51+
+  char config_xml_[16]{};
+  char status_xml_[16]{};
+  // Layouts for the handshake XML names (gecko_layouts.h), inYT v65 until they arrive
+  const MessageLayout *config_layout_{DEFAULT_CONFIG_LAYOUT};
+  const MessageLayout *status_layout_{DEFAULT_STATUS_LAYOUT};
 
-  // UART buffer
-  char uart_buffer_[512];
-  uint16_t uart_pos_{0};
+  // Proxy link mode (V1 hex lines until the proxy acknowledges MODE:V2)
+  std::atomic<bool> link_v2_{false};  // Read by the receive task when it sends ACKs
+  std::atomic<bool> proxy_acks_{false};  // Proxy confirmed ACK:ON, so we don't ACK handshakes
+  bool capturing_{false};  // Proxy confirmed CAPTURE:ON
 
-  // Multi-part message buffer (byte[10]=0x01 means more coming, 0x00 means last)
-  uint8_t msg_buffer_[512];
-  uint16_t msg_buffer_len_{0};
+  // Incremental UART receiver. Text lines, RX:<len>:<hex> lines and binary frames
+  // (between 0x00 delimiters) are decoded as bytes arrive, straight into the free tail
+  // of rx_arena_.
+  enum class RxState : uint8_t {
+    LINE,     // Text line into the arena tail
+    RX_LEN,   // Length of an RX: line
+    RX_HEX,   // Hex payload of an RX: line
+    FRAME,    // COBS-encoded binary frame
+    DISCARD,  // Malformed line, skip to end of line
+  };
+  static const size_t UART_CHUNK{64};            // Bytes per read_array call
+  static const size_t MAX_UART_PER_LOOP{512};    // Bound on bytes handled per loop()
+  RxState rx_state_{RxState::LINE};
+  uint8_t line_pos_{0};
+  uint8_t *rx_dest_{nullptr};    // Where decoded payload bytes go
+  uint16_t rx_capacity_{0};
+  uint16_t rx_pos_{0};           // Payload bytes (RX line) or decoded bytes (frame) so far
+  uint16_t rx_expected_{0};      // Length announced by an RX: line
+  uint8_t rx_nibble_{0};         // Pending high nibble | 0x10, 0 when none
+  uint8_t rx_header_[3];         // Frame type and length
+  uint16_t rx_encoded_{0};       // Encoded frame bytes so far
+  uint8_t cobs_left_{0};         // Data bytes left in the current COBS block
+  bool cobs_zero_{false};        // Current block ends with an implied zero
+  bool rx_overflow_{false};
 
-  // GO keep-alive message
-  static const uint8_t GO_MESSAGE[15];
+  // Frames dropped by the proxy's receive ring since it booted (from OVF: reports)
+  uint16_t proxy_ring_overflows_{0};
+  uint16_t proxy_oversize_drops_{0};
 
-  // Autodetected status message length
-  // Currently we don't parse beyond offset 112, so a min length of 120 is safe.
+  // Receive arena, sized to the protocol: the multi-part message being reassembled
+  // (byte[9]=0x01 means more coming, 0x00 means last) followed by room for one frame,
+  // with a capture header, and its link CRC. The frame or text line being received always goes into the tail, so
+  // parts are decoded and appended in place and nothing is copied twice.
+  static const uint16_t MAX_MESSAGE_LEN{SPA_MAX_MESSAGE};
+  static const uint16_t MAX_FRAME_LEN{SPA_MAX_FRAME};
+  static const uint8_t MAX_PROXY_LINE{64};  // Longest text line from the proxy, NUL included
+  static const uint16_t RX_ARENA_SIZE{MAX_MESSAGE_LEN + CAPTURE_HEADER_LEN + MAX_FRAME_LEN + 1};
+  static_assert(MAX_PROXY_LINE <= MAX_FRAME_LEN + 1, "Proxy lines must fit the arena tail");
+  uint8_t rx_arena_[RX_ARENA_SIZE];
+  uint16_t rx_msg_len_{0};  // Reassembled message bytes at the start of rx_arena_
+
+  // Parts of a message arrive back to back, and every part but the last carries a full
+  // payload. A part that breaks either rule, fails its checksum or doesn't fit aborts the
+  // message, and the rest of its parts are dropped up to its last one.
+  static const uint32_t PART_TIMEOUT_MS{200};
+  uint32_t last_part_time_{0};
+  bool rx_msg_discard_{false};  // Dropping the remaining parts of an aborted message
+
+  // Optional receive task (ESP32). It drains the UART, decodes link frames, ACKs the
+  // handshake and reassembles messages, so protocol timing doesn't depend on loop().
+  // Complete messages and proxy lines reach loop() through rx_queue_, and everything
+  // that decodes into entity state or publishes stays on loop().
+  static const uint8_t RX_QUEUE_SLOTS{8};
+  static const uint32_t RX_TASK_STACK{4096};
+  static const uint8_t RX_TASK_PRIORITY{5};  // Above the main loop task
+  bool rx_task_{false};
+  bool rx_task_running_{false};
+  MessageQueue<MAX_MESSAGE_LEN> rx_queue_;
+
+  // Handshake and GO scheduling. GO goes out as soon as the proxy is ready, again at once
+  // if a handshake step stalls or status stops, and otherwise as a keep-alive whose
+  // interval doubles (up to GO_MAX_INTERVAL_MS) while status keeps flowing.
+  static const uint32_t GO_BASE_INTERVAL_MS{23000};
+  static const uint32_t GO_MAX_INTERVAL_MS{184000};
+  static const uint32_t HANDSHAKE_STEP_MS{3000};
+  static const uint8_t HANDSHAKE_MAX_ATTEMPTS{3};
+  static const uint32_t STATUS_STALL_MS{15000};  // No status for this long re-triggers the handshake
+  HandshakeState handshake_state_{HandshakeState::IDLE};
+  uint32_t handshake_step_time_{0};  // When the current step started waiting
+  uint8_t handshake_attempts_{0};    // GOs sent since the last complete handshake
+  uint32_t go_interval_{GO_BASE_INTERVAL_MS};
+  bool go_pending_{true};            // Send GO as soon as pacing allows
+
+  // Outbound command queue, one slot per target and per pending write position
+  PendingCommand commands_[(size_t) CommandTarget::COUNT];
+  static const uint32_t COMMAND_PACING_MS{400};    // Minimum gap between transmissions
+  static const uint32_t COMMAND_RETRY_MS{2500};    // Resend if not confirmed by then
+  static const uint8_t COMMAND_MAX_ATTEMPTS{4};
+
+  // Config section of the config+status message. Config rarely changes, so it is only
+  // decoded and published when the checksum of the section differs from the last one.
+  uint32_t config_checksum_{0};
+  bool config_received_{false};
+
+  // Status message length from the status layout, or autodetected (see message_layout.h)
   uint16_t status_msg_len_{0};
-  static const uint16_t MIN_STATUS_MSG_LEN{120};
 
-  uint8_t calc_checksum(const uint8_t *data, uint8_t len);
+  // Publish stage: PublishEntity bits marked during decode, flushed by loop()
+  uint32_t publish_dirty_{0};
+  uint32_t published_{0};  // Entities published at least once
+  uint32_t publish_interval_[(size_t) PublishEntity::COUNT]{};  // Minimum ms between publishes
+  uint32_t last_publish_[(size_t) PublishEntity::COUNT]{};
+  float temperature_hysteresis_{0.1f};  // Current temperature change that is published
+  static_assert((size_t) PublishEntity::COUNT <= 32, "PublishEntity bits");
+
+  // Previous status payload, diffed against each new one so only changed fields are
+  // re-decoded. Field values are decoded from it on demand rather than cached.
+  uint8_t last_status_[MAX_STATUS_MSG_LEN];
+  uint16_t last_status_len_{0};
+
+  // Decoded state kept in flash, so entities have values right after a reboot or OTA.
+  // Restored values are published as stale until the first live status message.
+  struct SpaSnapshot {
+    uint8_t version;  // SNAPSHOT_VERSION, bumped whenever the layout changes
+    uint8_t status_len;
+    char config_xml[16];
+    char status_xml[16];
+    uint16_t notification_due[4];
+    uint8_t status[MAX_STATUS_MSG_LEN];
+  };
+  static const uint8_t SNAPSHOT_VERSION{2};
+  ESPPreferenceObject snapshot_pref_;
+  uint32_t snapshot_interval_{600000};  // Minimum ms between flash writes, 0 disables snapshots
+  uint32_t last_snapshot_time_{0};
+  bool snapshot_dirty_{false};
+  bool snapshot_stale_{false};
+
+  // Run time and energy per device, only kept when a meter sensor is configured. The
+  // totals are saved to flash at most once per meter_save_interval_ and on a safe reboot.
+  EnergyMeter meter_;
+  bool metering_{false};
+  ESPPreferenceObject meter_pref_;
+  uint32_t meter_save_interval_{3600000};  // 0 = totals since boot only
+  uint32_t last_meter_save_{0};
+  bool meter_dirty_{false};
+
+  const FieldDesc *find_writable_field(uint16_t pos, uint8_t width) const;
+  bool queue_write(uint16_t pos, uint8_t width, uint16_t value);
+  void queue_command(CommandTarget target, const uint8_t *frame, uint8_t len, uint16_t expected);
+  void service_commands();
+  void confirm_command(CommandTarget target, uint16_t observed);
+  PendingCommand *find_write(uint16_t pos);
   void send_i2c_message(const uint8_t *data, uint8_t len);
   uint8_t hex_to_byte(char high, char low);
+  void configure_proxy();
+  void service_handshake();
+  void set_handshake_state(HandshakeState state);
   void process_proxy_message(const char *msg);
-  void process_i2c_message(const uint8_t *data, uint8_t len);
-  void parse_status_message(const uint8_t *data);
+  void receive_bytes(const uint8_t *data, size_t len);
+  void begin_rx_payload(uint16_t offset);
+  void receive_frame_byte(uint8_t c);
+  void store_frame_byte(uint8_t c);
+  void finish_link_frame();
+  void finish_rx_line();
+  void process_link_frame(uint8_t type, const uint8_t *payload, uint16_t payload_len);
+  void drain_uart();
+  void start_rx_task();
+  static void rx_task(void *arg);
+  void deliver(QueuedKind kind, const uint8_t *data, uint16_t len);
+  void dispatch(QueuedKind kind, const uint8_t *data, uint16_t len);
+  void process_rx_queue();
+  void note_spa_traffic();
+  void mark_connected();
+  void process_i2c_message(const uint8_t *data, uint8_t len, bool traced = false);
+  void abort_message(bool more_coming);
+  void handle_spa_frame(const uint8_t *data, uint8_t len);
+  void process_reassembled_message(const uint8_t *msg, uint16_t msg_len);
+  void parse_status_message(const uint8_t *data, uint16_t len);
+  void parse_config_message(const uint8_t *data, uint16_t len);
+  int32_t log_value(LogField id) const {
+    return decode_field(status_layout_->fields[(size_t) id], last_status_, last_status_len_, status_layout_->base);
+  }
+  const char *log_value_name(LogField id) const {
+    return field_value_name(status_layout_->fields[(size_t) id], log_value(id));
+  }
+  void mark_dirty(PublishEntity entity) { publish_dirty_ |= 1u << (size_t) entity; }
+  void flush_publishes();
+  void publish_entity(PublishEntity entity);
+  void confirm_status_commands();
+  void confirm_write(const uint8_t *data, uint16_t len, uint16_t base);
   void parse_notification_message(const uint8_t *data);
+  text_sensor::TextSensor *notification_sensor(uint8_t id);
+  void publish_notification(uint8_t index);
+  void apply_xml_name(const char *xml_name);
+  void restore_snapshot();
+  void save_snapshot();
+  void update_meter(uint32_t now);
+  void restore_meter();
+  void save_meter();
   int days_since_2000(int day, int month, int year);
   void update_climate_state();
+  void publish_metrics();
 };
 
 class GeckoSpaClimate : public Component, public climate::Climate {
@@ -232,13 +505,13 @@ class GeckoSpaClimate : public Component, public climate::Climate {
 class GeckoSpaSwitch : public Component, public switch_::Switch {
  public:
   void set_parent(GeckoSpa *parent) { parent_ = parent; }
-  void set_switch_type(const std::string &type) { switch_type_ = type; }
+  void set_switch_type(SwitchType type) { switch_type_ = type; }
 
   void write_state(bool state) override;
 
  protected:
   GeckoSpa *parent_{nullptr};
-  std::string switch_type_;
+  SwitchType switch_type_{SwitchType::LIGHT};
 };
 
 class GeckoSpaSelect : public Component, public select::Select {
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace esphome {
+namespace gecko_spa {
+
+// Kinds of message counted by LinkStats
+enum class FrameKind : uint8_t {
+  STATUS,        // Reassembled status message
+  CONFIG,        // Reassembled config+status message
+  PART,          // One part of a multi-part message
+  NOTIFICATION,
+  HANDSHAKE,     // GO, XML, clock and LO
+  PROGRAM,
+  OTHER,
+  COUNT
+};
+
+// Link metrics that can be published as sensors
+enum class MetricSensor : uint8_t {
+  UART_RX_RATE,       // Bytes/s read from the proxy
+  FRAME_RATE,         // Frames/min received from the proxy
+  FRAME_ERRORS,       // Malformed, truncated or corrupt proxy frames (total)
+  REASSEMBLY_ERRORS,  // Reassembled messages that match no known layout (total)
+  BUFFER_OVERFLOWS,   // Frames and messages dropped because they didn't fit the receive arena (total)
+  CHECKSUM_ERRORS,    // Spa frames failing their XOR checksum (total)
+  SEQUENCE_ERRORS,    // Messages aborted because a part was missing (total)
+  REASSEMBLY_TIMEOUTS,  // Partial messages discarded because the next part never came (total)
+  TX_ERRORS,          // Frames the proxy failed to put on the I2C bus (total)
+  TX_LATENCY,         // Average us from the proxy queueing a frame to the spa taking it
+  STATUS_INTERVAL,    // Average ms between status messages
+  COMMAND_LATENCY,    // Average ms from queueing a command to the spa reporting its state
+  LOOP_TIME,          // Average us per loop() call
+  LOOP_TIME_MAX,      // Longest loop() call, us
+  COUNT
+};
+
+// Count, sum and maximum of the samples in one reporting window
+struct Accumulator {
+  uint32_t count{0};
+  uint32_t sum{0};
+  uint32_t max{0};
+
+  void add(uint32_t v) {
+    count++;
+    sum += v;
+    if (v > max)
+      max = v;
+  }
+  float average() const { return count ? (float) sum / count : NAN; }
+  void reset() { count = sum = max = 0; }
+};
+
+// Link-health counters and timings. Updating them is a few integer operations per
+// event, so they stay enabled whether or not any metric sensors are configured.
+// With the receive task enabled, the task updates the receive counters while loop()
+// publishes and resets the window; a rare lost increment is acceptable for metrics.
+struct LinkStats {
+  uint32_t frames[(size_t) FrameKind::COUNT]{};  // Since boot
+  uint32_t frame_errors{0};
+  uint32_t reassembly_errors{0};
+  uint32_t buffer_overflows{0};
+  uint32_t checksum_errors{0};
+  uint32_t sequence_errors{0};
+  uint32_t reassembly_timeouts{0};
+  uint32_t tx_errors{0};
+
+  // Current reporting window
+  uint32_t window_start{0};
+  uint32_t window_frames{0};     // Frames received from the proxy
+  uint32_t uart_bytes{0};
+  Accumulator status_interval;  // ms
+  Accumulator command_latency;  // ms
+  Accumulator loop_time;        // us
+  Accumulator tx_latency;       // us, reported by the proxy
+
+  uint32_t last_status_time{0};
+
+  void count(FrameKind kind) { frames[(size_t) kind]++; }
+  void reset_window(uint32_t now) {
+    window_start = now;
+    window_frames = 0;
+    uart_bytes = 0;
+    status_interval.reset();
+    command_latency.reset();
+    loop_time.reset();
+    tx_latency.reset();
+  }
+};
+
+}  // namespace gecko_spa
+}  // namespace esphome
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "gecko_fields.h"
+
+namespace esphome {
+namespace gecko_spa {
+
+// Reassembled multi-part messages (part headers stripped), told apart by length:
+//   status         ~160 bytes, the status (log) struct from message byte 0
+//   config+status  ~390 bytes, the config struct from CFG_OFFSET, then the status
+//                  message again at the very end, preceded by a 0x3B marker
+// The status length is consistent per pack and software version. It comes from the
+// layout registry (gecko_layouts.h) when the handshake names a known layout, and is
+// otherwise detected once from the first message that looks like status.
+static const uint16_t CFG_OFFSET = 2;  // Message byte = geckolib config offset + 2
+// Currently we don't parse beyond offset 112, so a min length of 120 is safe.
+static const uint16_t MIN_STATUS_MSG_LEN = 120;
+static const uint16_t MAX_STATUS_MSG_LEN = 170;
+static const uint16_t MIN_CONFIG_MSG_LEN = 300;
+static const uint16_t MAX_CONFIG_MSG_LEN = 400;
+
+enum class MessageKind : uint8_t { STATUS, CONFIG, UNKNOWN };
+
+// Could this be a status message, while the status length is still unknown?
+inline bool looks_like_status(const uint8_t *msg, uint16_t len) {
+  return len >= MIN_STATUS_MSG_LEN && len <= MAX_STATUS_MSG_LEN && msg[1] == 0x00;
+}
+
+// status_len: known or detected status length, 0 while unknown
+inline MessageKind classify_message(const uint8_t *msg, uint16_t len, uint16_t status_len) {
+  if (status_len != 0 && len == status_len && msg[1] == 0x00)
+    return MessageKind::STATUS;
+  if (len >= MIN_CONFIG_MSG_LEN && len <= MAX_CONFIG_MSG_LEN)
+    return MessageKind::CONFIG;
+  return MessageKind::UNKNOWN;
+}
+
+// Offset of the status portion of a config+status message, 0 if it can't be found
+inline uint16_t config_status_offset(const uint8_t *msg, uint16_t len, uint16_t status_len,
+                                     uint16_t config_offset = CFG_OFFSET) {
+  if (status_len == 0 || len < status_len + config_offset + 1)
+    return 0;
+  uint16_t offset = len - status_len;
+  if (msg[offset - 1] != 0x3B || msg[offset + 1] != 0x00)
+    return 0;
+  return offset;
+}
+
+// Length of the config section of a config+status message, capped at the bytes the
+// field table covers (config_struct_len)
+inline uint16_t config_section_len(uint16_t len, uint16_t status_len, uint16_t config_struct_len,
+                                   uint16_t config_offset = CFG_OFFSET) {
+  uint16_t config_len = len - status_len - config_offset;
+  return config_len > config_struct_len ? config_struct_len : config_len;
+}
+
+// Where a pack's config or status struct sits in its messages, for a range of the
+// versions in the handshake XML names (inYT_C65.xml, inYT_S65.xml). The registry is
+// generated into gecko_layouts.h.
+struct MessageLayout {
+  const char *pack;           // XML name prefix, e.g. "inYT"
+  char kind;                  // 'C' config or 'S' status, after the '_' in the XML name
+  uint8_t min_version;
+  uint8_t max_version;
+  const FieldDesc *fields;    // Indexed by ConfigField or LogField
+  uint16_t base;              // Field position of the first byte of the section
+  uint16_t offset;            // Message byte the section starts at
+  uint16_t len;               // Status: message length (0 = detect). Config: bytes the fields cover.
+};
+
+// Split an XML name into pack, kind and version; false if it has no _C or _S version
+// or the version doesn't fit the layout ranges (0-255)
+inline bool parse_xml_name(const char *xml_name, size_t *pack_len, char *kind, uint8_t *version) {
+  const char *sep = strstr(xml_name, "_C");
+  if (sep == nullptr)
+    sep = strstr(xml_name, "_S");
+  if (sep == nullptr)
+    return false;
+  long parsed = strtol(sep + 2, nullptr, 10);
+  if (parsed < 0 || parsed > 255)
+    return false;
+  *pack_len = sep - xml_name;
+  *kind = sep[1];
+  *version = parsed;
+  return true;
+}
+
+// Layout for an XML name, nullptr if there is none for its kind and version. Packs
+// without layouts of their own get the first one covering the version (exact = false).
+template<size_t N>
+const MessageLayout *find_layout(const MessageLayout (&layouts)[N], const char *xml_name, bool *exact) {
+  size_t pack_len;
+  char kind;
+  uint8_t version;
+  if (!parse_xml_name(xml_name, &pack_len, &kind, &version))
+    return nullptr;
+  const MessageLayout *fallback = nullptr;
+  for (const MessageLayout &layout : layouts) {
+    if (layout.kind != kind || version < layout.min_version || version > layout.max_version)
+      continue;
+    if (strlen(layout.pack) == pack_len && strncmp(layout.pack, xml_name, pack_len) == 0) {
+      *exact = true;
+      return &layout;
+    }
+    if (fallback == nullptr)
+      fallback = &layout;
+  }
+  *exact = false;
+  return fallback;
+}
+
+}  // namespace gecko_spa
+}  // namespace esphome
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace esphome {
+namespace gecko_spa {
+
+// What a queued entry holds
+enum class QueuedKind : uint8_t {
+  FRAME,       // Single I2C frame from the spa (handshake, notification, program...)
+  MESSAGE,     // Reassembled multi-part message, part headers stripped
+  PROXY_LINE,  // NUL-terminated text line from the proxy (READY, ACK:ON, OVF:...)
+};
+
+// Lock-free single-producer/single-consumer ring of fixed-size slots, used to hand
+// messages from the receive task to loop(). head_ is only written by the producer and
+// tail_ only by the consumer, so release/acquire ordering on them is all the
+// synchronisation needed. One slot is kept free to tell full from empty.
+template<uint16_t SlotSize> class MessageQueue {
+ public:
+  struct Entry {
+    QueuedKind kind;
+    uint16_t len;
+    uint8_t data[SlotSize];
+  };
+
+  // Allocates the slots; call before the producer starts
+  void init(uint8_t slots) {
+    delete[] entries_;
+    entries_ = new Entry[slots];
+    slots_ = slots;
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+  }
+
+  // Producer: copy an entry in. False if the queue is full or the entry too long.
+  bool push(QueuedKind kind, const uint8_t *data, uint16_t len) {
+    if (len > SlotSize)
+      return false;
+    uint8_t head = head_.load(std::memory_order_relaxed);
+    uint8_t next = (head + 1) % slots_;
+    if (next == tail_.load(std::memory_order_acquire))
+      return false;
+    Entry &entry = entries_[head];
+    entry.kind = kind;
+    entry.len = len;
+    memcpy(entry.data, data, len);
+    head_.store(next, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer: oldest entry, or nullptr when empty. Stays valid until pop().
+  const Entry *front() const {
+    uint8_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire))
+      return nullptr;
+    return &entries_[tail];
+  }
+  void pop() { tail_.store((tail_.load(std::memory_order_relaxed) + 1) % slots_, std::memory_order_release); }
+
+ protected:
+  Entry *entries_{nullptr};
+  uint8_t slots_{0};
+  std::atomic<uint8_t> head_{0};  // Next slot to fill
+  std::atomic<uint8_t> tail_{0};  // Oldest filled slot
+};
+
+}  // namespace gecko_spa
+}  // namespace esphome
@@ -0,0 +1,96 @@
+#include "proxy_link.h"
+
+namespace esphome {
+namespace gecko_spa {
+
+const char *capture_result_name(uint8_t result) {
+  switch (result) {
+    case 0:
+      return "OK";
+    case 2:
+      return "NACK_ADDR";
+    case 3:
+      return "NACK_DATA";
+    case 4:
+      return "ARB_LOST";
+    case 5:
+      return "TIMEOUT";
+    default:
+      return "BUS_ERROR";
+  }
+}
+
+uint8_t link_crc8(const uint8_t *data, size_t len, uint8_t crc) {
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc & 0x80) ? (uint8_t) ((crc << 1) ^ 0x07) : (uint8_t) (crc << 1);
+  }
+  return crc;
+}
+
+size_t link_encode_frame(uint8_t type, const uint8_t *payload, uint16_t len, uint8_t *out) {
+  uint8_t header[3] = {type, (uint8_t) (len & 0xFF), (uint8_t) (len >> 8)};
+  uint8_t crc = link_crc8(payload, len, link_crc8(header, 3));
+  size_t total = len + LINK_FRAME_OVERHEAD;
+
+  // Source byte i of the unencoded frame: header, payload, crc
+  auto at = [&](size_t i) -> uint8_t {
+    if (i < 3)
+      return header[i];
+    if (i < total - 1)
+      return payload[i - 3];
+    return crc;
+  };
+
+  size_t pos = 0;
+  out[pos++] = LINK_DELIMITER;
+  size_t code_pos = pos++;
+  uint8_t code = 1;
+  for (size_t i = 0; i < total; i++) {
+    uint8_t b = at(i);
+    if (b == 0) {
+      out[code_pos] = code;
+      code_pos = pos++;
+      code = 1;
+      continue;
+    }
+    out[pos++] = b;
+    if (++code == 0xFF) {
+      out[code_pos] = code;
+      code_pos = pos++;
+      code = 1;
+    }
+  }
+  out[code_pos] = code;
+  out[pos++] = LINK_DELIMITER;
+  return pos;
+}
+
+bool link_decode_frame(uint8_t *buf, size_t len, uint8_t *type, const uint8_t **payload, uint16_t *payload_len) {
+  // COBS decode in place (output never overtakes input)
+  size_t in = 0, out = 0;
+  while (in < len) {
+    uint8_t code = buf[in++];
+    if (code == 0 || in + code - 1 > len)
+      return false;
+    for (uint8_t i = 1; i < code; i++)
+      buf[out++] = buf[in++];
+    if (code != 0xFF && in < len)
+      buf[out++] = 0;
+  }
+
+  if (out < LINK_FRAME_OVERHEAD)
+    return false;
+  uint16_t plen = buf[1] | (buf[2] << 8);
+  if (plen != out - LINK_FRAME_OVERHEAD || link_crc8(buf, out - 1) != buf[out - 1])
+    return false;
+
+  *type = buf[0];
+  *payload = buf + 3;
+  *payload_len = plen;
+  return true;
+}
+
+}  // namespace gecko_spa
+}  // namespace esphome
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace gecko_spa {
+
+// Binary proxy link (V2) framing, shared with arduino/src/main.cpp:
+//   0x00 <COBS(type, len_lo, len_hi, payload..., crc8)> 0x00
+// crc8 is CRC-8/SMBUS (poly 0x07, init 0x00) over type, length and payload.
+// V1 text lines (READY, TX:OK, PONG...) may still be interleaved between frames.
+static const uint8_t LINK_DELIMITER = 0x00;
+static const uint8_t LINK_FRAME_RX = 'R';  // I2C message received from spa (proxy -> ESP)
+static const uint8_t LINK_FRAME_TX = 'T';  // I2C message to send to spa (ESP -> proxy)
+static const uint8_t LINK_FRAME_MSG = 'M';  // Multi-part payload reassembled by the proxy
+static const uint8_t LINK_FRAME_CAPTURE = 'C';  // Timestamped bus event (proxy -> ESP, CAPTURE mode)
+static const uint8_t LINK_FRAME_OVERHEAD = 4;  // type + 2 length bytes + crc
+
+// Spa protocol limits that size the buffers on both ends (FRAME_MAX, RING_SLOTS and
+// MAX_TX_FRAME in the proxy). The longest spa message is a 78-byte part of a multi-part
+// message: a 16-byte header and 62 payload bytes. The config+status message, the
+// longest reassembled one, takes 7 parts; 8 are allowed for.
+static const uint8_t SPA_MAX_FRAME = 78;
+static const uint8_t SPA_PART_HEADER_LEN = 16;
+static const uint8_t SPA_MAX_PARTS = 8;
+static const uint16_t SPA_MAX_MESSAGE = SPA_MAX_PARTS * (SPA_MAX_FRAME - SPA_PART_HEADER_LEN);
+
+// Capture frame payload: event, endTransmission() result of a transmit attempt
+// (0 = OK), the proxy's micros() (4, little-endian), then the I2C bytes. Received
+// frames are stamped as they end, transmit attempts as they start.
+static const uint8_t CAPTURE_EVENT_RX = 'R';
+static const uint8_t CAPTURE_EVENT_TX = 'T';
+static const uint8_t CAPTURE_HEADER_LEN = 6;
+
+// Name of a capture transmit result
+const char *capture_result_name(uint8_t result);
+
+// Worst-case encoded size of a frame with the given payload length, including both delimiters
+constexpr size_t link_encoded_size(size_t payload_len) {
+  return payload_len + LINK_FRAME_OVERHEAD + (payload_len + LINK_FRAME_OVERHEAD) / 254 + 1 + 2;
+}
+
+uint8_t link_crc8(const uint8_t *data, size_t len, uint8_t crc = 0);
+
+// Encode a frame into out (which must hold link_encoded_size(len) bytes).
+// Returns the number of bytes to send, delimiters included.
+size_t link_encode_frame(uint8_t type, const uint8_t *payload, uint16_t len, uint8_t *out);
+
+// Decode a frame in place (delimiters already stripped). On success points payload into buf.
+bool link_decode_frame(uint8_t *buf, size_t len, uint8_t *type, const uint8_t **payload, uint16_t *payload_len);
+
+}  // namespace gecko_spa
+}  // namespace esphome
@@ -1,30 +1,136 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import sensor
-from esphome.const import CONF_ID, UNIT_MINUTE, ICON_TIMER
-from . import gecko_spa_ns, GeckoSpa
+from esphome.const import (
+    CONF_ID,
+    UNIT_MINUTE,
+    UNIT_MILLISECOND,
+    UNIT_CELSIUS,
+    UNIT_HOUR,
+    UNIT_KILOWATT_HOURS,
+    ICON_TIMER,
+    DEVICE_CLASS_DURATION,
+    DEVICE_CLASS_ENERGY,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+)
+from . import (
+    gecko_spa_ns,
+    GeckoSpa,
+    METERED_DEVICES,
+    MIN_PUBLISH_INTERVAL_SCHEMA,
+    PublishEntity,
+    set_publish_interval,
+)
 
 DEPENDENCIES = ["gecko_spa"]
 
 CONF_GECKO_SPA_ID = "gecko_spa_id"
 CONF_SENSOR_TYPE = "type"
 
-SENSOR_TYPES = {
-    "pump_timer": "PUMP_TIMER",
+MetricSensor = gecko_spa_ns.enum("MetricSensor", is_class=True)
+ConfigField = gecko_spa_ns.enum("ConfigField", is_class=True)
+
+# Decoded config fields, published when the spa's config changes:
+# type: (field, unit, accuracy, icon). Times and durations are in minutes.
+CONFIG_SENSORS = {
+    "pump_timeout": (ConfigField.PumpTimeOut, UNIT_MINUTE, 0, "mdi:timer-cog"),
+    "light_timeout": (ConfigField.LightTimeOut, UNIT_MINUTE, 0, "mdi:timer-cog"),
+    "filter_frequency": (ConfigField.FiltFreq, "cycles/day", 0, "mdi:air-filter"),
+    "filter_duration": (ConfigField.FiltDur, UNIT_MINUTE, 0, "mdi:air-filter"),
+    "economy_duration": (ConfigField.EconDur, UNIT_MINUTE, 0, "mdi:leaf"),
+    "min_setpoint": (ConfigField.MinSetpointG, UNIT_CELSIUS, 1, "mdi:thermometer-chevron-down"),
+    "max_setpoint": (ConfigField.MaxSetpointG, UNIT_CELSIUS, 1, "mdi:thermometer-chevron-up"),
+}
+
+# Link-health metrics, published every metrics_interval:
+# type: (enum, unit, accuracy, icon, state class)
+METRIC_SENSORS = {
+    "uart_rx_rate": (MetricSensor.UART_RX_RATE, "B/s", 0, "mdi:speedometer", STATE_CLASS_MEASUREMENT),
+    "frame_rate": (MetricSensor.FRAME_RATE, "frames/min", 1, "mdi:swap-horizontal", STATE_CLASS_MEASUREMENT),
+    "frame_errors": (MetricSensor.FRAME_ERRORS, None, 0, "mdi:alert-circle-outline", STATE_CLASS_TOTAL_INCREASING),
+    "reassembly_errors": (MetricSensor.REASSEMBLY_ERRORS, None, 0, "mdi:puzzle-remove", STATE_CLASS_TOTAL_INCREASING),
+    "buffer_overflows": (MetricSensor.BUFFER_OVERFLOWS, None, 0, "mdi:tray-full", STATE_CLASS_TOTAL_INCREASING),
+    "checksum_errors": (MetricSensor.CHECKSUM_ERRORS, None, 0, "mdi:checkbox-marked-circle-minus-outline", STATE_CLASS_TOTAL_INCREASING),
+    "sequence_errors": (MetricSensor.SEQUENCE_ERRORS, None, 0, "mdi:sort-numeric-variant-remove", STATE_CLASS_TOTAL_INCREASING),
+    "reassembly_timeouts": (MetricSensor.REASSEMBLY_TIMEOUTS, None, 0, "mdi:timer-remove-outline", STATE_CLASS_TOTAL_INCREASING),
+    "tx_errors": (MetricSensor.TX_ERRORS, None, 0, "mdi:send-lock-outline", STATE_CLASS_TOTAL_INCREASING),
+    "tx_latency": (MetricSensor.TX_LATENCY, "µs", 0, "mdi:send-clock-outline", STATE_CLASS_MEASUREMENT),
+    "status_interval": (MetricSensor.STATUS_INTERVAL, UNIT_MILLISECOND, 0, ICON_TIMER, STATE_CLASS_MEASUREMENT),
+    "command_latency": (MetricSensor.COMMAND_LATENCY, UNIT_MILLISECOND, 0, "mdi:timer-sand", STATE_CLASS_MEASUREMENT),
+    "loop_time": (MetricSensor.LOOP_TIME, "µs", 1, "mdi:timer-outline", STATE_CLASS_MEASUREMENT),
+    "loop_time_max": (MetricSensor.LOOP_TIME_MAX, "µs", 0, "mdi:timer-alert-outline", STATE_CLASS_MEASUREMENT),
+}
+
+# Run time and energy since the meter was first started, per device and in total. They
+# are published every meter_publish_interval of the gecko_spa component.
+METER_SENSORS = {
+    **{f"{name}_runtime": ("runtime", device) for name, device in METERED_DEVICES.items()},
+    **{f"{name}_energy": ("energy", device) for name, device in METERED_DEVICES.items()},
+    "total_energy": ("total", None),
 }
 
-CONFIG_SCHEMA = sensor.sensor_schema(
-    unit_of_measurement=UNIT_MINUTE,
-    icon=ICON_TIMER,
-    accuracy_decimals=0,
-).extend(
+BASE_SCHEMA = cv.Schema(
     {
         cv.GenerateID(CONF_GECKO_SPA_ID): cv.use_id(GeckoSpa),
-        cv.Required(CONF_SENSOR_TYPE): cv.enum(SENSOR_TYPES, lower=True),
     }
 )
 
 
+def metric_schema(unit, accuracy, icon, state_class):
+    kwargs = {"unit_of_measurement": unit} if unit is not None else {}
+    return sensor.sensor_schema(
+        icon=icon,
+        accuracy_decimals=accuracy,
+        state_class=state_class,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        **kwargs,
+    ).extend(BASE_SCHEMA)
+
+
+def meter_schema(kind):
+    if kind == "runtime":
+        kwargs = {
+            "unit_of_measurement": UNIT_HOUR,
+            "icon": "mdi:timer-play-outline",
+            "accuracy_decimals": 2,
+            "device_class": DEVICE_CLASS_DURATION,
+        }
+    else:
+        kwargs = {"unit_of_measurement": UNIT_KILOWATT_HOURS, "accuracy_decimals": 3, "device_class": DEVICE_CLASS_ENERGY}
+    return sensor.sensor_schema(state_class=STATE_CLASS_TOTAL_INCREASING, **kwargs).extend(BASE_SCHEMA)
+
+
+CONFIG_SCHEMA = cv.typed_schema(
+    {
+        "pump_timer": sensor.sensor_schema(
+            unit_of_measurement=UNIT_MINUTE,
+            icon=ICON_TIMER,
+            accuracy_decimals=0,
+        )
+        .extend(BASE_SCHEMA)
+        .extend(MIN_PUBLISH_INTERVAL_SCHEMA),
+        **{name: meter_schema(kind) for name, (kind, _) in METER_SENSORS.items()},
+        **{
+            name: metric_schema(unit, accuracy, icon, state_class)
+            for name, (_, unit, accuracy, icon, state_class) in METRIC_SENSORS.items()
+        },
+        **{
+            name: sensor.sensor_schema(
+                unit_of_measurement=unit,
+                icon=icon,
+                accuracy_decimals=accuracy,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ).extend(BASE_SCHEMA)
+            for name, (_, unit, accuracy, icon) in CONFIG_SENSORS.items()
+        },
+    },
+    key=CONF_SENSOR_TYPE,
+    lower=True,
+)
+
+
 async def to_code(config):
     parent = await cg.get_variable(config[CONF_GECKO_SPA_ID])
     var = await sensor.new_sensor(config)
@@ -32,3 +138,16 @@ async def to_code(config):
     sensor_type = config[CONF_SENSOR_TYPE]
     if sensor_type == "pump_timer":
         cg.add(parent.set_pump_timer_sensor(var))
+        await set_publish_interval(parent, PublishEntity.PUMP_TIMER, config)
+    elif sensor_type in METER_SENSORS:
+        kind, device = METER_SENSORS[sensor_type]
+        if kind == "runtime":
+            cg.add(parent.set_runtime_sensor(device, var))
+        elif kind == "energy":
+            cg.add(parent.set_energy_sensor(device, var))
+        else:
+            cg.add(parent.set_total_energy_sensor(var))
+    elif sensor_type in METRIC_SENSORS:
+        cg.add(parent.set_metric_sensor(METRIC_SENSORS[sensor_type][0], var))
+    elif sensor_type in CONFIG_SENSORS:
+        cg.add(parent.add_config_sensor(CONFIG_SENSORS[sensor_type][0], var))
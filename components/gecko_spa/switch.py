@@ -2,22 +2,38 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import switch
 from esphome.const import CONF_ID
-from . import gecko_spa_ns, GeckoSpa
+from . import (
+    gecko_spa_ns,
+    GeckoSpa,
+    MIN_PUBLISH_INTERVAL_SCHEMA,
+    PublishEntity,
+    set_publish_interval,
+)
 
 DEPENDENCIES = ["gecko_spa"]
 
 GeckoSpaSwitch = gecko_spa_ns.class_("GeckoSpaSwitch", switch.Switch, cg.Component)
+SwitchType = gecko_spa_ns.enum("SwitchType", is_class=True)
 
 CONF_GECKO_SPA_ID = "gecko_spa_id"
 CONF_SWITCH_TYPE = "type"
 
 SWITCH_TYPES = {
-    "light": "light",
-    "circulation": "circulation",
-    "pump1": "pump1",
-    "pump2": "pump2",
-    "pump3": "pump3",
-    "pump4": "pump4",
+    "light": SwitchType.LIGHT,
+    "circulation": SwitchType.CIRCULATION,
+    "pump1": SwitchType.PUMP1,
+    "pump2": SwitchType.PUMP2,
+    "pump3": SwitchType.PUMP3,
+    "pump4": SwitchType.PUMP4,
+}
+
+PUBLISH_ENTITIES = {
+    "light": PublishEntity.LIGHT,
+    "circulation": PublishEntity.CIRCULATION,
+    "pump1": PublishEntity.PUMP1,
+    "pump2": PublishEntity.PUMP2,
+    "pump3": PublishEntity.PUMP3,
+    "pump4": PublishEntity.PUMP4,
 }
 
 CONFIG_SCHEMA = switch.switch_schema(GeckoSpaSwitch).extend(
@@ -25,7 +41,7 @@ CONFIG_SCHEMA = switch.switch_schema(GeckoSpaSwitch).extend(
         cv.GenerateID(CONF_GECKO_SPA_ID): cv.use_id(GeckoSpa),
         cv.Required(CONF_SWITCH_TYPE): cv.enum(SWITCH_TYPES, lower=True),
     }
-).extend(cv.COMPONENT_SCHEMA)
+).extend(MIN_PUBLISH_INTERVAL_SCHEMA).extend(cv.COMPONENT_SCHEMA)
 
 
 async def to_code(config):
@@ -35,6 +51,7 @@ async def to_code(config):
 
     cg.add(var.set_parent(parent))
     cg.add(var.set_switch_type(config[CONF_SWITCH_TYPE]))
+    await set_publish_interval(parent, PUBLISH_ENTITIES[config[CONF_SWITCH_TYPE]], config)
 
     switch_type = config[CONF_SWITCH_TYPE]
     if switch_type == "light":
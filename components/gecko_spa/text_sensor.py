@@ -2,7 +2,14 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import text_sensor
 from esphome.const import CONF_ID
-from . import gecko_spa_ns, GeckoSpa
+from . import (
+    gecko_spa_ns,
+    GeckoSpa,
+    MIN_PUBLISH_INTERVAL_SCHEMA,
+    PublishEntity,
+    set_publish_interval,
+    validate_publish_interval,
+)
 
 DEPENDENCIES = ["gecko_spa"]
 
@@ -19,13 +26,39 @@ SENSOR_TYPES = {
     "status_version": "STATUS_VERSION",
     "lock_mode": "LOCK_MODE",
     "pack_type": "PACK_TYPE",
+    "frame_counts": "FRAME_COUNTS",  # Link metric, published every metrics_interval
+    "handshake": "HANDSHAKE",  # Handshake state, published on change
+}
+
+# Types published from status messages
+PUBLISH_ENTITIES = {
+    "lock_mode": PublishEntity.LOCK_MODE,
+    "pack_type": PublishEntity.PACK_TYPE,
+}
+
+ConfigField = gecko_spa_ns.enum("ConfigField", is_class=True)
+
+# Decoded config fields, published when the spa's config changes
+CONFIG_TEXT_SENSORS = {
+    "temperature_units": ConfigField.TempUnits,
+    "time_format": ConfigField.TimeFormat,
+    "economy_type": ConfigField.EconType,
+    "silent_mode": ConfigField.SilentMode,
+    "filter_start": ConfigField.FiltStart,
+    "economy_start": ConfigField.EconStart,
+    "customer": ConfigField.CustomerID,
 }
 
-CONFIG_SCHEMA = text_sensor.text_sensor_schema().extend(
-    {
-        cv.GenerateID(CONF_GECKO_SPA_ID): cv.use_id(GeckoSpa),
-        cv.Required(CONF_SENSOR_TYPE): cv.enum(SENSOR_TYPES, lower=True),
-    }
+CONFIG_SCHEMA = cv.All(
+    text_sensor.text_sensor_schema()
+    .extend(
+        {
+            cv.GenerateID(CONF_GECKO_SPA_ID): cv.use_id(GeckoSpa),
+            cv.Required(CONF_SENSOR_TYPE): cv.one_of(*SENSOR_TYPES, *CONFIG_TEXT_SENSORS, lower=True),
+        }
+    )
+    .extend(MIN_PUBLISH_INTERVAL_SCHEMA),
+    validate_publish_interval(PUBLISH_ENTITIES),
 )
 
 
@@ -34,6 +67,8 @@ async def to_code(config):
     var = await text_sensor.new_text_sensor(config)
 
     sensor_type = config[CONF_SENSOR_TYPE]
+    if sensor_type in PUBLISH_ENTITIES:
+        await set_publish_interval(parent, PUBLISH_ENTITIES[sensor_type], config)
     if sensor_type == "spa_time":
         cg.add(parent.set_spa_time_sensor(var))
     elif sensor_type == "rinse_filter":
@@ -52,3 +87,9 @@ async def to_code(config):
         cg.add(parent.set_lock_mode_sensor(var))
     elif sensor_type == "pack_type":
         cg.add(parent.set_pack_type_sensor(var))
+    elif sensor_type == "frame_counts":
+        cg.add(parent.set_frame_counts_sensor(var))
+    elif sensor_type == "handshake":
+        cg.add(parent.set_handshake_sensor(var))
+    elif sensor_type in CONFIG_TEXT_SENSORS:
+        cg.add(parent.add_config_text_sensor(CONFIG_TEXT_SENSORS[sensor_type], var))
@@ -0,0 +1,136 @@
+#include "trace_buffer.h"
+#include "proxy_link.h"
+#include "esphome/core/log.h"
+#include <cinttypes>
+#include <cstring>
+
+namespace esphome {
+namespace gecko_spa {
+
+static const char *const TAG = "gecko_spa.trace";
+
+void TraceBuffer::init(size_t size) {
+  delete[] buf_;
+  buf_ = nullptr;
+  size_ = size;
+  head_ = used_ = 0;
+  records_ = 0;
+  overwritten_ = 0;
+  if (size > RECORD_HEADER)
+    buf_ = new uint8_t[size];
+}
+
+void TraceBuffer::put_(const uint8_t *data, size_t len) {
+  size_t first = size_ - head_ < len ? size_ - head_ : len;
+  memcpy(buf_ + head_, data, first);
+  memcpy(buf_, data + first, len - first);
+  head_ = (head_ + len) % size_;
+  used_ += len;
+}
+
+void TraceBuffer::get_(size_t pos, uint8_t *out, size_t len) const {
+  pos %= size_;
+  size_t first = size_ - pos < len ? size_ - pos : len;
+  memcpy(out, buf_ + pos, first);
+  memcpy(out + first, buf_, len - first);
+}
+
+void TraceBuffer::drop_oldest_() {
+  uint8_t header[RECORD_HEADER];
+  get_(head_ + size_ - used_, header, RECORD_HEADER);
+  used_ -= RECORD_HEADER + (header[5] | (header[6] << 8));
+  records_--;
+  overwritten_++;
+}
+
+void TraceBuffer::record(uint32_t time_ms, uint8_t type, const uint8_t *data, uint16_t len) {
+  if (buf_ == nullptr)
+    return;
+  LockGuard guard(lock_);
+  if (RECORD_HEADER + len > size_)
+    len = size_ - RECORD_HEADER;  // Keep the start of frames larger than the whole ring
+  while (size_ - used_ < RECORD_HEADER + len)
+    drop_oldest_();
+
+  uint8_t header[RECORD_HEADER] = {
+      (uint8_t) time_ms, (uint8_t) (time_ms >> 8), (uint8_t) (time_ms >> 16), (uint8_t) (time_ms >> 24),
+      type, (uint8_t) len, (uint8_t) (len >> 8),
+  };
+  put_(header, RECORD_HEADER);
+  put_(data, len);
+  records_++;
+}
+
+void TraceBuffer::dump() {
+  if (buf_ == nullptr) {
+    ESP_LOGW(TAG, "Trace buffer disabled (trace_buffer_size: 0)");
+    return;
+  }
+  LockGuard guard(lock_);
+  ESP_LOGI(TAG, "Trace: %u frames (%u bytes), %" PRIu32 " older frames overwritten", records_,
+           (unsigned) used_, overwritten_);
+
+  // RX/TX frames are logged in the proxy's V1 line format, reassembled messages as
+  // FULL-RX. Capture events add the proxy's micros() (and a transmit's result):
+  //   RX:<len>:<hex> @<us>    TX:<len>:<hex> @<us> <result>
+  static const char HEX_DIGITS[] = "0123456789ABCDEF";
+  static const uint16_t LINE_BYTES = 128;  // Largest single I2C frame
+  static const uint16_t CHUNK_BYTES = 32;
+  uint8_t data[CAPTURE_HEADER_LEN + LINE_BYTES];
+  char hex_str[LINE_BYTES * 2 + 1];
+  auto to_hex = [&](const uint8_t *bytes, uint16_t len) {
+    for (uint16_t i = 0; i < len; i++) {
+      hex_str[i * 2] = HEX_DIGITS[bytes[i] >> 4];
+      hex_str[i * 2 + 1] = HEX_DIGITS[bytes[i] & 0x0F];
+    }
+    hex_str[len * 2] = '\0';
+  };
+
+  size_t pos = head_ + size_ - used_;
+  while (records_ > 0) {
+    uint8_t header[RECORD_HEADER];
+    get_(pos, header, RECORD_HEADER);
+    uint32_t time_ms = header[0] | (header[1] << 8) | (header[2] << 16) | ((uint32_t) header[3] << 24);
+    uint16_t len = header[5] | (header[6] << 8);
+    pos += RECORD_HEADER;
+
+    if (header[4] == LINK_FRAME_CAPTURE && len >= CAPTURE_HEADER_LEN && len <= sizeof(data)) {
+      get_(pos, data, len);
+      uint32_t time_us = data[2] | (data[3] << 8) | (data[4] << 16) | ((uint32_t) data[5] << 24);
+      uint16_t frame_len = len - CAPTURE_HEADER_LEN;
+      to_hex(data + CAPTURE_HEADER_LEN, frame_len);
+      if (data[0] == CAPTURE_EVENT_TX) {
+        ESP_LOGI(TAG, "%10" PRIu32 " TX:%d:%s @%" PRIu32 " %s", time_ms, frame_len, hex_str, time_us,
+                 capture_result_name(data[1]));
+      } else {
+        ESP_LOGI(TAG, "%10" PRIu32 " RX:%d:%s @%" PRIu32, time_ms, frame_len, hex_str, time_us);
+      }
+    } else if (header[4] != LINK_FRAME_MSG && len <= LINE_BYTES) {
+      get_(pos, data, len);
+      to_hex(data, len);
+      ESP_LOGI(TAG, "%10" PRIu32 " %s:%d:%s", time_ms, header[4] == LINK_FRAME_TX ? "TX" : "RX", len, hex_str);
+    } else {
+      ESP_LOGI(TAG, "%10" PRIu32 " FULL-RX:%d bytes", time_ms, len);
+      for (uint16_t offset = 0; offset < len; offset += CHUNK_BYTES) {
+        uint16_t chunk_len = len - offset < CHUNK_BYTES ? len - offset : CHUNK_BYTES;
+        get_(pos + offset, data, chunk_len);
+        to_hex(data, chunk_len);
+        ESP_LOGI(TAG, "  %03d: %s", offset, hex_str);
+      }
+    }
+    pos += len;
+    used_ -= RECORD_HEADER + len;
+    records_--;
+  }
+  overwritten_ = 0;
+}
+
+void TraceBuffer::clear() {
+  LockGuard guard(lock_);
+  head_ = used_ = 0;
+  records_ = 0;
+  overwritten_ = 0;
+}
+
+}  // namespace gecko_spa
+}  // namespace esphome
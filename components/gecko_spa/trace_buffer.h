@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace gecko_spa {
+
+// Fixed-size binary ring of raw I2C frames. Recording is a timestamped memcpy;
+// frames are only formatted as hex when the ring is dumped. When full, the
+// oldest records are overwritten.
+//
+// Record layout: time_ms (4, little-endian), type (1), len (2, little-endian), data (len)
+// type is the proxy link frame type: LINK_FRAME_RX, LINK_FRAME_TX, LINK_FRAME_MSG, or
+// LINK_FRAME_CAPTURE with the capture payload (header and I2C bytes) as data.
+// record() and dump() may be called from the receive task and loop() concurrently.
+class TraceBuffer {
+ public:
+  static const size_t RECORD_HEADER = 7;
+
+  // Allocates the ring; size 0 disables tracing
+  void init(size_t size);
+  bool enabled() const { return buf_ != nullptr; }
+
+  void record(uint32_t time_ms, uint8_t type, const uint8_t *data, uint16_t len);
+
+  // Log all records, oldest first, then empty the ring
+  void dump();
+  void clear();
+
+  uint16_t records() const { return records_; }
+  uint32_t overwritten() const { return overwritten_; }
+
+ protected:
+  void put_(const uint8_t *data, size_t len);
+  void get_(size_t pos, uint8_t *out, size_t len) const;
+  void drop_oldest_();
+
+  uint8_t *buf_{nullptr};
+  size_t size_{0};
+  size_t head_{0};  // Next byte to write
+  size_t used_{0};  // Bytes held, oldest record starts at head_ - used_
+  uint16_t records_{0};
+  uint32_t overwritten_{0};  // Records dropped to make room since the last dump
+  Mutex lock_;
+};
+
+}  // namespace gecko_spa
+}  // namespace esphome
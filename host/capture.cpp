@@ -0,0 +1,232 @@
+// Analyses a proxy bus capture (start_capture()/stop_capture() on the ESP32) and reports
+// inter-frame gaps, bus occupancy, handshake ACK latency and transmit results.
+//
+// Accepted input: the capture lines of a trace dump, anything else is ignored so raw
+// ESPHome logs work:
+//   RX:<len>:<hex> @<us>            frame received, stamped as it ended
+//   TX:<len>:<hex> @<us> <result>   transmit attempt, stamped as it started
+// Bus time is estimated from the frame length at the I2C clock (-k, default 100 kHz).
+//
+// Usage: gecko_capture [-k khz] [-c out.csv] capture.log
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "command_frame.h"
+
+using namespace esphome::gecko_spa;
+
+namespace {
+
+struct Event {
+  bool tx;
+  uint64_t time_us;  // Proxy micros(), unwrapped
+  std::string result;
+  std::vector<uint8_t> data;
+  double bus_us;  // Estimated bus time
+  double start_us;
+  double end_us;
+};
+
+bool parse_hex(const std::string &hex, std::vector<uint8_t> *out) {
+  if (hex.size() % 2 != 0)
+    return false;
+  for (size_t i = 0; i < hex.size(); i += 2) {
+    if (!isxdigit((unsigned char) hex[i]) || !isxdigit((unsigned char) hex[i + 1]))
+      return false;
+    out->push_back(strtoul(hex.substr(i, 2).c_str(), nullptr, 16));
+  }
+  return true;
+}
+
+std::vector<Event> load_capture(const char *path) {
+  std::vector<Event> events;
+  std::ifstream in(path);
+  std::string line;
+  uint32_t last_raw = 0;
+  uint64_t last_time = 0;
+
+  while (std::getline(in, line)) {
+    size_t at = line.find(" @");
+    if (at == std::string::npos)
+      continue;
+    size_t pos = line.rfind("RX:", at);
+    size_t tx = line.rfind("TX:", at);
+    if (pos == std::string::npos || (tx != std::string::npos && tx > pos))
+      pos = tx;
+    if (pos == std::string::npos)
+      continue;
+
+    // <len>:<hex>
+    Event ev{};
+    ev.tx = line[pos] == 'T';
+    char *end;
+    unsigned long len = strtoul(line.c_str() + pos + 3, &end, 10);
+    size_t hex = end + 1 - line.c_str();
+    if (*end != ':' || !parse_hex(line.substr(hex, at - hex), &ev.data) || ev.data.size() != len)
+      continue;
+
+    // @<us> [result]
+    uint32_t raw = strtoul(line.c_str() + at + 2, &end, 10);
+    while (*end == ' ')
+      end++;
+    ev.result = end;
+    while (!ev.result.empty() && isspace((unsigned char) ev.result.back()))
+      ev.result.pop_back();
+    if (ev.tx && ev.result.empty())
+      continue;
+
+    // micros() wraps every 71 minutes; events may arrive slightly out of order
+    last_time = events.empty() ? raw : last_time + (int32_t) (raw - last_raw);
+    last_raw = raw;
+    ev.time_us = last_time;
+    events.push_back(ev);
+  }
+  return events;
+}
+
+// Start, address and data bytes with their ACK bits, stop. A successful transmit is
+// followed by the repeated start and 2-byte read the spa expects.
+double bus_time_us(const Event &ev, double khz) {
+  unsigned bits = 9 * (1 + ev.data.size()) + 2;
+  if (ev.tx && ev.result == "OK")
+    bits += 1 + 9 * 3;
+  else if (ev.tx && ev.result == "NACK_ADDR")
+    bits = 9 + 2;
+  return bits * 1000.0 / khz;
+}
+
+bool is_handshake(const Event &ev) {
+  return !ev.tx && (ev.data.size() == 33 || (ev.data.size() == 22 && ev.data[13] == 0x4B));
+}
+
+bool is_frame(const Event &ev, const uint8_t *frame, size_t len) {
+  return ev.data.size() == len && memcmp(ev.data.data(), frame, len) == 0;
+}
+
+void print_summary(const char *name, std::vector<double> values) {
+  if (values.empty()) {
+    printf("%-15s none\n", name);
+    return;
+  }
+  std::sort(values.begin(), values.end());
+  double total = 0;
+  for (double v : values)
+    total += v;
+  auto pct = [&](double p) { return values[std::min(values.size() - 1, (size_t) (p * values.size()))]; };
+  printf("%-15s min %.0f  avg %.0f  p50 %.0f  p99 %.0f  max %.0f  (%zu)\n", name, values.front(),
+         total / values.size(), pct(0.50), pct(0.99), values.back(), values.size());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  double khz = 100;
+  const char *csv_path = nullptr;
+  const char *path = nullptr;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+      khz = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+      csv_path = argv[++i];
+    } else {
+      path = argv[i];
+    }
+  }
+  if (path == nullptr || khz <= 0) {
+    fprintf(stderr, "Usage: %s [-k khz] [-c out.csv] capture.log\n", argv[0]);
+    return 2;
+  }
+
+  std::vector<Event> events = load_capture(path);
+  if (events.empty()) {
+    fprintf(stderr, "No capture events found in %s\n", path);
+    return 1;
+  }
+
+  size_t rx_count = 0;
+  std::map<std::string, size_t> results;
+  for (Event &ev : events) {
+    ev.bus_us = bus_time_us(ev, khz);
+    ev.start_us = ev.tx ? ev.time_us : ev.time_us - ev.bus_us;
+    ev.end_us = ev.start_us + ev.bus_us;
+    if (ev.tx)
+      results[ev.result]++;
+    else
+      rx_count++;
+  }
+  // Events reach the ESP in forwarding order, not bus order
+  std::stable_sort(events.begin(), events.end(),
+                   [](const Event &a, const Event &b) { return a.start_us < b.start_us; });
+
+  // Gaps between the end of one frame and the start of the next (overlapping estimates
+  // count as back to back), and the time the bus was busy
+  std::vector<double> gaps;
+  double busy = events[0].bus_us;
+  double busy_until = events[0].end_us;
+  for (size_t i = 1; i < events.size(); i++) {
+    const Event &ev = events[i];
+    gaps.push_back(std::max(0.0, ev.start_us - busy_until));
+    busy += std::max(0.0, ev.end_us - std::max(ev.start_us, busy_until));
+    busy_until = std::max(busy_until, ev.end_us);
+  }
+  double span = busy_until - events.front().start_us;
+
+  // How long after a handshake message the ACK that got through was started, and how
+  // long after our GO the spa answered
+  std::vector<double> ack_latency, go_response;
+  for (size_t i = 0; i < events.size(); i++) {
+    if (is_handshake(events[i])) {
+      for (size_t j = i + 1; j < events.size(); j++) {
+        if (is_frame(events[j], AckFrame::BYTES.data(), AckFrame::LEN) && events[j].result == "OK") {
+          ack_latency.push_back(events[j].start_us - events[i].end_us);
+          break;
+        }
+        if (is_handshake(events[j]))
+          break;
+      }
+    } else if (is_frame(events[i], GoFrame::BYTES.data(), GoFrame::LEN) && events[i].tx && events[i].result == "OK") {
+      auto reply = std::find_if(events.begin() + i + 1, events.end(), [](const Event &e) { return !e.tx; });
+      if (reply != events.end())
+        go_response.push_back(reply->start_us - events[i].end_us);
+    }
+  }
+
+  printf("Events:        %zu received, %zu transmit attempts over %.3f s\n", rx_count, events.size() - rx_count,
+         span / 1e6);
+  printf("Bus occupancy: %.1f%% (at %.0f kHz)\n", span > 0 ? busy * 100 / span : 0.0, khz);
+  printf("Transmits:    ");
+  for (const auto &r : results)
+    printf(" %s %zu", r.first.c_str(), r.second);
+  printf("%s\n", results.empty() ? " none" : "");
+  print_summary("Gaps (us):", gaps);
+  print_summary("ACK (us):", ack_latency);
+  print_summary("GO reply (us):", go_response);
+
+  if (csv_path != nullptr) {
+    FILE *csv = fopen(csv_path, "w");
+    if (csv == nullptr) {
+      perror(csv_path);
+      return 1;
+    }
+    fprintf(csv, "start_us,dir,len,bus_us,gap_us,result,data\n");
+    for (size_t i = 0; i < events.size(); i++) {
+      const Event &ev = events[i];
+      fprintf(csv, "%.0f,%s,%zu,%.0f,%.0f,%s,", ev.start_us - events.front().start_us, ev.tx ? "TX" : "RX",
+              ev.data.size(), ev.bus_us, i == 0 ? 0.0 : gaps[i - 1], ev.tx ? ev.result.c_str() : "");
+      for (uint8_t b : ev.data)
+        fprintf(csv, "%02X", b);
+      fprintf(csv, "\n");
+    }
+    fclose(csv);
+  }
+  return 0;
+}
@@ -0,0 +1,537 @@
+// Decodes the reassembled messages (FULL-RX blocks) in saved logs with the component's
+// field tables and message layout, into per-field time series. Files are memory-mapped
+// and cut into chunks at line boundaries; chunks are decoded in parallel and written in
+// order, so the output is the same for any number of threads.
+//
+// Accepted input: dump_trace() output and verbose_log logs, anything else is ignored:
+//   [time] FULL-RX:<n> bytes        followed by "  <offset>: <hex>" lines
+// The time column is the trace timestamp (ms) in front of FULL-RX, or the [HH:MM:SS]
+// or "YYYY-MM-DD HH:MM:SS" prefix a log viewer added.
+//
+// Writes <prefix>.status.csv and <prefix>.config.csv, one row per message and one column
+// per field (temperatures in degC, enums by name, times as HH:MM, blank if unavailable).
+// With -c, raw field values are written column by column instead, as int32 arrays in
+// <prefix>.status.npy / <prefix>.config.npy (numpy.load) with the column names in
+// <prefix>.status.columns / <prefix>.config.columns; -1 marks unavailable values.
+//
+// Usage: gecko_decode [-j threads] [-x xml_name] [-s status_len] [-f Field,...] [-c] [-o prefix] log...
+//   -x   decode with the layout for a handshake XML name, e.g. inYT_S50.xml (repeat for
+//        the config name; default: the inYT v65 layouts)
+//   -s   status message length (default: from the -x status layout, or detected like the
+//        component from the first 120-170 byte message with byte[1] = 0)
+//   -f   only these fields (status and config names)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gecko_layouts.h"
+
+using namespace esphome::gecko_spa;
+
+namespace {
+
+struct MappedFile {
+  const char *path;
+  const char *data{nullptr};
+  size_t size{0};
+};
+
+// One output table: the selected fields of a struct
+struct Table {
+  const FieldDesc *fields;
+  uint16_t base;                  // Message byte = field position - base
+  std::vector<uint16_t> columns;  // Selected field indices
+};
+
+// Lines [begin, end) of a file; messages whose FULL-RX line starts here belong to the
+// chunk, their hex lines may run past end
+struct Chunk {
+  uint32_t file;
+  const char *begin;
+  const char *end;
+  uint32_t first_line{0};  // Line number of begin, 1-based
+  uint32_t lines{0};
+  std::string csv[2];  // Status and config rows
+  std::vector<int32_t> raw[2];
+  uint32_t rows[2]{};
+  uint32_t skipped{0};  // Messages neither status nor config+status
+};
+
+enum { STATUS_TABLE = 0, CONFIG_TABLE = 1 };
+
+struct Options {
+  const MessageLayout *layouts[2]{DEFAULT_STATUS_LAYOUT, DEFAULT_CONFIG_LAYOUT};
+  uint16_t status_len{0};
+  bool columnar{false};
+  Table tables[2];
+};
+
+int8_t HEX_VALUE[256];
+
+const char *find_in(const char *begin, const char *end, const char *needle) {
+  size_t n = strlen(needle);
+  for (const char *p = begin; p + n <= end; p++) {
+    p = (const char *) memchr(p, needle[0], end - p);
+    if (p == nullptr || p + n > end)
+      return nullptr;
+    if (memcmp(p, needle, n) == 0)
+      return p;
+  }
+  return nullptr;
+}
+
+const char *line_end(const char *p, const char *end) {
+  const char *nl = (const char *) memchr(p, '\n', end - p);
+  return nl ? nl : end;
+}
+
+// "  <offset>: <hex>" block line: appends the bytes if offset matches what we have so far
+bool parse_hex_line(const char *p, const char *eol, std::vector<uint8_t> *out) {
+  while (eol > p && (eol[-1] == '\r' || eol[-1] == ' '))
+    eol--;
+  const char *colon = nullptr;
+  for (const char *q = eol - 1; q > p; q--) {
+    if (q[0] == ':' && q + 1 < eol && q[1] == ' ') {
+      colon = q;
+      break;
+    }
+  }
+  if (colon == nullptr || colon - p < 3)
+    return false;
+  size_t offset = 0;
+  for (const char *d = colon - 3; d < colon; d++) {
+    if (*d < '0' || *d > '9')
+      return false;
+    offset = offset * 10 + (*d - '0');
+  }
+  if (offset != out->size())
+    return false;
+  const char *hex = colon + 2;
+  if (hex == eol || (eol - hex) % 2 != 0)
+    return false;
+  for (const char *h = hex; h < eol; h += 2) {
+    int8_t hi = HEX_VALUE[(uint8_t) h[0]], lo = HEX_VALUE[(uint8_t) h[1]];
+    if (hi < 0 || lo < 0)
+      return false;
+    out->push_back((hi << 4) | lo);
+  }
+  return true;
+}
+
+// Timestamp of a FULL-RX line, see the header comment
+std::string line_time(const char *line, const char *full) {
+  const char *end = full;
+  while (end > line && end[-1] == ' ')
+    end--;
+  const char *start = end;
+  while (start > line && start[-1] >= '0' && start[-1] <= '9')
+    start--;
+  if (start < end && (start == line || start[-1] == ' '))
+    return std::string(start, end);
+  if (line[0] == '[') {
+    const char *close = (const char *) memchr(line, ']', full - line);
+    if (close != nullptr && memchr(line, ':', close - line) != nullptr)
+      return std::string(line + 1, close);
+  }
+  if (full - line >= 19 && line[4] == '-' && line[7] == '-' && line[13] == ':')
+    return std::string(line, line + 19);
+  return "";
+}
+
+void format_value(const FieldDesc &f, int32_t value, std::string *out) {
+  char buf[16];
+  if (value == FIELD_UNAVAILABLE)
+    return;
+  switch (f.type) {
+    case FieldType::TEMP:
+      snprintf(buf, sizeof(buf), "%.1f", value / 18.0f);
+      break;
+    case FieldType::TIME:
+      snprintf(buf, sizeof(buf), "%02d:%02d", (int) (value >> 8), (int) (value & 0xFF));
+      break;
+    case FieldType::ENUM:
+      out->append(field_value_name(f, value));
+      return;
+    default:
+      snprintf(buf, sizeof(buf), "%d", (int) value);
+      break;
+  }
+  out->append(buf);
+}
+
+void emit_row(const Options &opt, int which, uint32_t line, const std::string &time, const uint8_t *data,
+              uint16_t len, Chunk *chunk) {
+  const Table &table = opt.tables[which];
+  if (opt.columnar) {
+    std::vector<int32_t> &raw = chunk->raw[which];
+    raw.push_back(chunk->file);
+    raw.push_back(line);
+    for (uint16_t i : table.columns)
+      raw.push_back(decode_field(table.fields[i], data, len, table.base));
+  } else {
+    std::string &csv = chunk->csv[which];
+    csv += std::to_string(chunk->file);
+    csv += ',';
+    csv += std::to_string(line);
+    csv += ',';
+    csv += time;
+    for (uint16_t i : table.columns) {
+      csv += ',';
+      format_value(table.fields[i], decode_field(table.fields[i], data, len, table.base), &csv);
+    }
+    csv += '\n';
+  }
+  chunk->rows[which]++;
+}
+
+void decode_message(const Options &opt, uint32_t line, const std::string &time, const std::vector<uint8_t> &msg,
+                    Chunk *chunk) {
+  const uint8_t *data = msg.data();
+  uint16_t len = msg.size();
+  switch (classify_message(data, len, opt.status_len)) {
+    case MessageKind::STATUS:
+      emit_row(opt, STATUS_TABLE, line, time, data, len, chunk);
+      break;
+    case MessageKind::CONFIG: {
+      const MessageLayout &config = *opt.layouts[CONFIG_TABLE];
+      emit_row(opt, CONFIG_TABLE, line, time, data + config.offset,
+               config_section_len(len, opt.status_len, config.len, config.offset), chunk);
+      uint16_t status_offset = config_status_offset(data, len, opt.status_len, config.offset);
+      if (status_offset != 0)
+        emit_row(opt, STATUS_TABLE, line, time, data + status_offset, opt.status_len, chunk);
+      break;
+    }
+    default:
+      chunk->skipped++;
+      break;
+  }
+}
+
+// Calls fn(line_number, line_start, full_rx_pos, message) for each complete FULL-RX
+// block starting in [begin, end); file_end bounds the hex lines
+template<typename Fn>
+void scan_messages(const char *begin, const char *end, const char *file_end, uint32_t first_line, Fn fn) {
+  std::vector<uint8_t> msg;
+  uint32_t line = first_line;
+  for (const char *p = begin; p < end; line++) {
+    const char *eol = line_end(p, file_end);
+    const char *full = find_in(p, eol, "FULL-RX:");
+    if (full != nullptr) {
+      size_t expected = strtoul(full + 8, nullptr, 10);
+      msg.clear();
+      const char *q = eol < file_end ? eol + 1 : file_end;
+      while (msg.size() < expected && q < file_end) {
+        const char *qe = line_end(q, file_end);
+        if (!parse_hex_line(q, qe, &msg))
+          break;
+        q = qe < file_end ? qe + 1 : file_end;
+      }
+      if (expected > 0 && msg.size() == expected && !fn(line, p, full, msg))
+        return;
+    }
+    p = eol < file_end ? eol + 1 : file_end;
+  }
+}
+
+bool map_file(MappedFile *file) {
+  int fd = open(file->path, O_RDONLY);
+  if (fd < 0) {
+    perror(file->path);
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    perror(file->path);
+    close(fd);
+    return false;
+  }
+  file->size = st.st_size;
+  if (file->size > 0) {
+    void *p = mmap(nullptr, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p == MAP_FAILED) {
+      perror(file->path);
+      close(fd);
+      return false;
+    }
+    madvise(p, file->size, MADV_SEQUENTIAL);
+    file->data = (const char *) p;
+  }
+  close(fd);
+  return true;
+}
+
+// Runs fn(chunk) for every chunk on a pool of threads
+template<typename Fn> void run_parallel(std::vector<Chunk> &chunks, unsigned threads, Fn fn) {
+  std::atomic<size_t> next{0};
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < threads; t++) {
+    pool.emplace_back([&] {
+      for (size_t i = next++; i < chunks.size(); i = next++)
+        fn(chunks[i]);
+    });
+  }
+  for (auto &th : pool)
+    th.join();
+}
+
+std::vector<std::string> column_names(const Table &table) {
+  std::vector<std::string> names = {"file", "line"};
+  for (uint16_t i : table.columns)
+    names.push_back(table.fields[i].name);
+  return names;
+}
+
+bool write_csv(const std::string &path, const Table &table, const std::vector<Chunk> &chunks, int which) {
+  FILE *out = fopen(path.c_str(), "w");
+  if (out == nullptr) {
+    perror(path.c_str());
+    return false;
+  }
+  fputs("file,line,time", out);
+  for (uint16_t i : table.columns)
+    fprintf(out, ",%s", table.fields[i].name);
+  fputc('\n', out);
+  for (const Chunk &chunk : chunks)
+    fwrite(chunk.csv[which].data(), 1, chunk.csv[which].size(), out);
+  fclose(out);
+  return true;
+}
+
+// int32 array in Fortran (column-major) order, so each field is contiguous
+bool write_npy(const std::string &prefix, const Table &table, const std::vector<Chunk> &chunks, int which) {
+  std::vector<std::string> names = column_names(table);
+  size_t cols = names.size();
+  size_t rows = 0;
+  for (const Chunk &chunk : chunks)
+    rows += chunk.rows[which];
+
+  std::string path = prefix + ".npy";
+  FILE *out = fopen(path.c_str(), "wb");
+  if (out == nullptr) {
+    perror(path.c_str());
+    return false;
+  }
+  std::string header = "{'descr': '<i4', 'fortran_order': True, 'shape': (" + std::to_string(rows) + ", " +
+                       std::to_string(cols) + "), }";
+  header.append(64 - (10 + header.size() + 1) % 64, ' ');
+  header += '\n';
+  const uint8_t magic[10] = {0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0, (uint8_t) header.size(),
+                             (uint8_t) (header.size() >> 8)};
+  fwrite(magic, 1, sizeof(magic), out);
+  fwrite(header.data(), 1, header.size(), out);
+
+  std::vector<int32_t> column(rows);
+  for (size_t c = 0; c < cols; c++) {
+    size_t r = 0;
+    for (const Chunk &chunk : chunks) {
+      const std::vector<int32_t> &raw = chunk.raw[which];
+      for (size_t i = c; i < raw.size(); i += cols)
+        column[r++] = raw[i];
+    }
+    fwrite(column.data(), sizeof(int32_t), rows, out);
+  }
+  fclose(out);
+
+  path = prefix + ".columns";
+  out = fopen(path.c_str(), "w");
+  if (out == nullptr) {
+    perror(path.c_str());
+    return false;
+  }
+  for (const std::string &name : names)
+    fprintf(out, "%s\n", name.c_str());
+  fclose(out);
+  return true;
+}
+
+// Comma-separated field names; empty selects all
+bool select_fields(const char *list, Options *opt) {
+  struct {
+    const FieldDesc *fields;
+    size_t count;
+  } structs[2] = {{opt->tables[STATUS_TABLE].fields, (size_t) LogField::COUNT},
+                  {opt->tables[CONFIG_TABLE].fields, (size_t) ConfigField::COUNT}};
+  for (int t = 0; t < 2; t++) {
+    for (size_t i = 0; i < structs[t].count; i++) {
+      if (list == nullptr && structs[t].fields[i].type != FieldType::NONE)
+        opt->tables[t].columns.push_back(i);
+    }
+  }
+  if (list == nullptr)
+    return true;
+
+  std::string names = list;
+  size_t start = 0;
+  while (start <= names.size()) {
+    size_t comma = names.find(',', start);
+    std::string name = names.substr(start, comma == std::string::npos ? std::string::npos : comma - start);
+    bool found = false;
+    for (int t = 0; t < 2; t++) {
+      for (size_t i = 0; i < structs[t].count; i++) {
+        if (name == structs[t].fields[i].name) {
+          opt->tables[t].columns.push_back(i);
+          found = true;
+        }
+      }
+    }
+    if (!found) {
+      fprintf(stderr, "Unknown field %s\n", name.c_str());
+      return false;
+    }
+    if (comma == std::string::npos)
+      break;
+    start = comma + 1;
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options opt;
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  const char *fields = nullptr;
+  std::string prefix = "decoded";
+  bool named_status = false;
+  std::vector<MappedFile> files;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      threads = std::max(1, atoi(argv[++i]));
+    } else if (strcmp(argv[i], "-x") == 0 && i + 1 < argc) {
+      bool exact;
+      const MessageLayout *layout = find_layout(MESSAGE_LAYOUTS, argv[++i], &exact);
+      if (layout == nullptr || !exact) {
+        fprintf(stderr, "No layout for %s\n", argv[i]);
+        return 2;
+      }
+      opt.layouts[layout->kind == 'S' ? STATUS_TABLE : CONFIG_TABLE] = layout;
+      named_status |= layout->kind == 'S';
+    } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      opt.status_len = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      fields = argv[++i];
+    } else if (strcmp(argv[i], "-c") == 0) {
+      opt.columnar = true;
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      prefix = argv[++i];
+    } else {
+      files.push_back({argv[i]});
+    }
+  }
+  if (files.empty()) {
+    fprintf(stderr, "Usage: %s [-j threads] [-x xml_name] [-s status_len] [-f Field,...] [-c] [-o prefix] log...\n",
+            argv[0]);
+    return 2;
+  }
+
+  for (int t = 0; t < 2; t++)
+    opt.tables[t] = {opt.layouts[t]->fields, opt.layouts[t]->base, {}};
+  if (opt.status_len == 0 && named_status)
+    opt.status_len = opt.layouts[STATUS_TABLE]->len;
+  if (!select_fields(fields, &opt))
+    return 2;
+  memset(HEX_VALUE, -1, sizeof(HEX_VALUE));
+  for (int c = 0; c < 16; c++) {
+    HEX_VALUE[(uint8_t) "0123456789ABCDEF"[c]] = c;
+    HEX_VALUE[(uint8_t) "0123456789abcdef"[c]] = c;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  size_t total_bytes = 0;
+  for (MappedFile &file : files) {
+    if (!map_file(&file))
+      return 1;
+    total_bytes += file.size;
+  }
+
+  // Status length as the component detects it: the first message that looks like status
+  for (size_t f = 0; f < files.size() && opt.status_len == 0; f++) {
+    const char *end = files[f].data + files[f].size;
+    scan_messages(files[f].data, end, end, 1,
+                  [&](uint32_t, const char *, const char *, const std::vector<uint8_t> &msg) {
+                    if (!looks_like_status(msg.data(), msg.size()))
+                      return true;
+                    opt.status_len = msg.size();
+                    return false;
+                  });
+  }
+  if (opt.status_len == 0)
+    fprintf(stderr, "No status message found, config+status messages decode without their status part\n");
+
+  // Chunks of at least 1 MB, several per thread to balance the load
+  std::vector<Chunk> chunks;
+  size_t chunk_size = std::max<size_t>(1 << 20, total_bytes / (threads * 4) + 1);
+  for (uint32_t f = 0; f < files.size(); f++) {
+    const char *p = files[f].data, *end = files[f].data + files[f].size;
+    while (p < end) {
+      const char *split = end - p > (ptrdiff_t) chunk_size ? line_end(p + chunk_size, end) : end;
+      if (split < end)
+        split++;
+      Chunk chunk;
+      chunk.file = f;
+      chunk.begin = p;
+      chunk.end = split;
+      chunks.push_back(std::move(chunk));
+      p = split;
+    }
+  }
+
+  // Line numbers: count lines per chunk, then number them in order
+  run_parallel(chunks, threads, [](Chunk &chunk) {
+    for (const char *p = chunk.begin; p < chunk.end; chunk.lines++) {
+      const char *nl = (const char *) memchr(p, '\n', chunk.end - p);
+      p = nl ? nl + 1 : chunk.end;
+    }
+  });
+  for (size_t i = 0; i < chunks.size(); i++) {
+    bool same_file = i > 0 && chunks[i - 1].file == chunks[i].file;
+    chunks[i].first_line = same_file ? chunks[i - 1].first_line + chunks[i - 1].lines : 1;
+  }
+
+  run_parallel(chunks, threads, [&](Chunk &chunk) {
+    const char *file_end = files[chunk.file].data + files[chunk.file].size;
+    scan_messages(chunk.begin, chunk.end, file_end, chunk.first_line,
+                  [&](uint32_t line, const char *line_start, const char *full, const std::vector<uint8_t> &msg) {
+                    decode_message(opt, line, line_time(line_start, full), msg, &chunk);
+                    return true;
+                  });
+  });
+
+  size_t rows[2] = {0, 0}, skipped = 0;
+  for (const Chunk &chunk : chunks) {
+    rows[0] += chunk.rows[0];
+    rows[1] += chunk.rows[1];
+    skipped += chunk.skipped;
+  }
+  const char *kinds[2] = {"status", "config"};
+  for (int which = 0; which < 2; which++) {
+    bool ok = opt.columnar ? write_npy(prefix + "." + kinds[which], opt.tables[which], chunks, which)
+                           : write_csv(prefix + "." + kinds[which] + ".csv", opt.tables[which], chunks, which);
+    if (!ok)
+      return 1;
+  }
+
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  fprintf(stderr, "Decoded %zu status and %zu config rows (%zu other messages) from %zu files, %.1f MB in %.2f s "
+          "(%.0f MB/s, %u threads, status length %u)\n", rows[0], rows[1], skipped, files.size(),
+          total_bytes / 1e6, elapsed, total_bytes / 1e6 / elapsed, threads, opt.status_len);
+  for (size_t f = 0; f < files.size(); f++) {
+    if (files[f].data != nullptr)
+      munmap((void *) files[f].data, files[f].size);
+    fprintf(stderr, "  file %zu: %s\n", f, files[f].path);
+  }
+  return 0;
+}
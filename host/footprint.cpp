@@ -0,0 +1,16 @@
+// Prints the RAM footprint of a GeckoSpa instance with the default configuration. Run as
+// a post-build step, so every host build reports how big the protocol buffers are.
+//
+// Usage: gecko_footprint
+
+#include "esphome/core/log.h"
+#include "gecko_spa.h"
+
+using namespace esphome;
+
+int main() {
+  host::log_level = ESPHOME_LOG_LEVEL_CONFIG;
+  gecko_spa::GeckoSpa spa;
+  spa.dump_config();
+  return 0;
+}
@@ -0,0 +1,299 @@
+// Runs GeckoSpa on the host against a serial device (a real proxy, or spa_sim's pty),
+// plays a command script and reports end-to-end command latency, UART throughput and
+// loop() cost.
+//
+// Script lines, times in ms from start ('#' starts a comment):
+//   <ms> light|circ|pump1..pump4 on|off
+//   <ms> program <0-4>
+//   <ms> setpoint <degC>
+//   <ms> write <position> byte|word|temp <value>
+//   <ms> end
+// A command's latency runs from issuing it until the spa's status reports the new state.
+//
+// Usage: gecko_link [-v] [-t timeout_ms] device script
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "gecko_spa.h"
+#include "host_entities.h"
+
+using namespace esphome;
+
+namespace {
+
+const char *const PROGRAM_NAMES[] = {"Away", "Standard", "Energy", "Super Energy", "Weekend"};
+const char *const SWITCH_NAMES[6] = {"light", "circ", "pump1", "pump2", "pump3", "pump4"};
+
+// Exposes the command queue so a latency sample ends at the component's own confirmation
+class LinkSpa : public gecko_spa::GeckoSpa {
+ public:
+  bool command_pending(gecko_spa::CommandTarget target) const { return commands_[(size_t) target].len != 0; }
+  bool write_pending(uint16_t pos) { return find_write(pos) != nullptr; }
+};
+
+struct Step {
+  uint32_t at_ms;
+  std::string what;  // Switch name, "program", "setpoint", "write" or "end"
+  float value;
+  uint16_t pos;      // write: struct position
+  gecko_spa::FieldType type;
+  std::string text;  // Original line, for reporting
+};
+
+struct Pending {
+  const Step *step;
+  uint32_t issued_ms;
+};
+
+double elapsed_ms(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool load_script(const char *path, std::vector<Step> *steps) {
+  std::ifstream in(path);
+  if (!in)
+    return false;
+  std::string line;
+  while (std::getline(in, line)) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream fields(line);
+    Step step{};
+    std::string arg;
+    if (!(fields >> step.at_ms >> step.what))
+      continue;
+    fields >> arg;
+    step.text = line;
+    if (step.what == "program" || step.what == "setpoint") {
+      step.value = atof(arg.c_str());
+    } else if (step.what == "write") {
+      std::string type;
+      step.pos = atoi(arg.c_str());
+      if (!(fields >> type >> step.value) || (type != "byte" && type != "word" && type != "temp")) {
+        fprintf(stderr, "Bad script line: %s\n", line.c_str());
+        return false;
+      }
+      step.type = type == "byte" ? gecko_spa::FieldType::BYTE
+                  : type == "word" ? gecko_spa::FieldType::WORD
+                                   : gecko_spa::FieldType::TEMP;
+    } else if (step.what != "end") {
+      if (std::find(std::begin(SWITCH_NAMES), std::end(SWITCH_NAMES), step.what) == std::end(SWITCH_NAMES) ||
+          (arg != "on" && arg != "off")) {
+        fprintf(stderr, "Bad script line: %s\n", line.c_str());
+        return false;
+      }
+      step.value = arg == "on";
+    }
+    steps->push_back(step);
+  }
+  std::stable_sort(steps->begin(), steps->end(), [](const Step &a, const Step &b) { return a.at_ms < b.at_ms; });
+  return true;
+}
+
+int switch_index(const std::string &name) {
+  return std::find(std::begin(SWITCH_NAMES), std::end(SWITCH_NAMES), name) - std::begin(SWITCH_NAMES);
+}
+
+// Issue a step's command; false if the component refused it
+bool issue(const Step &step, LinkSpa *spa, gecko_spa::HostEntities *entities) {
+  if (step.what == "program") {
+    entities->program.control(PROGRAM_NAMES[(int) step.value]);
+  } else if (step.what == "setpoint") {
+    spa->send_temperature_command(step.value);
+  } else if (step.what == "write") {
+    return spa->write_value(step.pos, step.type, step.value);
+  } else {
+    entities->switches[switch_index(step.what)].write_state(step.value != 0);
+  }
+  return true;
+}
+
+// Whether the spa has confirmed the command and reported the state the step asked for
+bool confirmed(const Step &step, LinkSpa *spa, gecko_spa::HostEntities *entities) {
+  using gecko_spa::CommandTarget;
+  if (step.what == "program")
+    return !spa->command_pending(CommandTarget::PROGRAM) && entities->program.state == PROGRAM_NAMES[(int) step.value];
+  // Confirmed by the config value, which the climate target (RealSetPointG) only
+  // matches outside economy mode
+  if (step.what == "setpoint")
+    return !spa->command_pending(CommandTarget::SETPOINT);
+  if (step.what == "write")
+    return !spa->write_pending(step.pos);
+  // Switch names are in CommandTarget order
+  if (spa->command_pending((CommandTarget) switch_index(step.what)))
+    return false;
+  bool on = step.value != 0;
+  switch (switch_index(step.what)) {
+    case 0:
+      return spa->get_light_state() == on;
+    case 1:
+      return spa->get_circ_state() == on;
+    case 2:
+      return (spa->get_pump1_state() != 0) == on;
+    case 3:
+      return (spa->get_pump2_state() != 0) == on;
+    case 4:
+      return (spa->get_pump3_state() != 0) == on;
+    default:
+      return (spa->get_pump4_state() != 0) == on;
+  }
+}
+
+int open_serial(const char *path) {
+  int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (fd < 0)
+    return -1;
+  struct termios tio;
+  if (tcgetattr(fd, &tio) == 0) {
+    cfmakeraw(&tio);
+    cfsetspeed(&tio, B115200);
+    tcsetattr(fd, TCSANOW, &tio);
+  }
+  return fd;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  uint32_t timeout_ms = 5000;
+  std::vector<const char *> paths;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-v") == 0) {
+      host::log_level = ESPHOME_LOG_LEVEL_DEBUG;
+    } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      timeout_ms = atoi(argv[++i]);
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+  if (paths.size() != 2) {
+    fprintf(stderr, "Usage: %s [-v] [-t timeout_ms] device script\n", argv[0]);
+    return 2;
+  }
+
+  std::vector<Step> steps;
+  if (!load_script(paths[1], &steps)) {
+    fprintf(stderr, "Cannot load script %s\n", paths[1]);
+    return 2;
+  }
+  int fd = open_serial(paths[0]);
+  if (fd < 0) {
+    perror(paths[0]);
+    return 1;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  LinkSpa spa;
+  gecko_spa::HostEntities entities(&spa);
+  host::set_millis(0);
+  spa.setup();
+
+  std::vector<Pending> pending;
+  std::vector<double> latencies;
+  size_t next_step = 0, timeouts = 0;
+  uint64_t rx_bytes = 0, tx_bytes = 0, loops = 0;
+  double loop_total_us = 0, loop_max_us = 0;
+  bool done = false;
+
+  while (!done) {
+    uint32_t now = (uint32_t) elapsed_ms(start);
+    host::set_millis(now);
+
+    // Serial input feeds the component's UART; drop what it has already consumed
+    if (spa.rx_pos > 0) {
+      spa.rx_data.erase(spa.rx_data.begin(), spa.rx_data.begin() + spa.rx_pos);
+      spa.rx_pos = 0;
+    }
+    uint8_t buf[512];
+    ssize_t n;
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+      spa.rx_data.insert(spa.rx_data.end(), buf, buf + n);
+      rx_bytes += n;
+    }
+
+    while (next_step < steps.size() && steps[next_step].at_ms <= now) {
+      const Step &step = steps[next_step++];
+      if (step.what == "end") {
+        done = true;
+        break;
+      }
+      if (issue(step, &spa, &entities))
+        pending.push_back({&step, now});
+      else
+        printf("%8u  %-24s rejected\n", now, step.text.c_str());
+    }
+
+    auto loop_start = std::chrono::steady_clock::now();
+    spa.loop();
+    double loop_us = elapsed_ms(loop_start) * 1000.0;
+    loop_total_us += loop_us;
+    loop_max_us = std::max(loop_max_us, loop_us);
+    loops++;
+
+    if (!spa.tx_data.empty()) {
+      if (write(fd, spa.tx_data.data(), spa.tx_data.size()) > 0)
+        tx_bytes += spa.tx_data.size();
+      spa.tx_data.clear();
+    }
+
+    now = (uint32_t) elapsed_ms(start);
+    for (auto it = pending.begin(); it != pending.end();) {
+      if (confirmed(*it->step, &spa, &entities)) {
+        latencies.push_back(now - it->issued_ms);
+        printf("%8u  %-24s confirmed after %u ms\n", now, it->step->text.c_str(), now - it->issued_ms);
+        it = pending.erase(it);
+      } else if (now - it->issued_ms > timeout_ms) {
+        timeouts++;
+        printf("%8u  %-24s TIMEOUT\n", now, it->step->text.c_str());
+        it = pending.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    if (next_step >= steps.size() && pending.empty())
+      done = true;
+
+    struct pollfd pfd = {fd, POLLIN, 0};
+    poll(&pfd, 1, 1);
+  }
+  close(fd);
+
+  double seconds = elapsed_ms(start) / 1000.0;
+  std::sort(latencies.begin(), latencies.end());
+  printf("\nRun time:      %.1f s, %llu loop() calls\n", seconds, (unsigned long long) loops);
+  printf("UART:          %.0f B/s in, %.0f B/s out\n", rx_bytes / seconds, tx_bytes / seconds);
+  printf("loop() (us):   avg %.2f  max %.2f\n", loops ? loop_total_us / loops : 0.0, loop_max_us);
+  if (!latencies.empty()) {
+    double total = 0;
+    for (double v : latencies)
+      total += v;
+    printf("Latency (ms):  min %.0f  avg %.1f  p50 %.0f  max %.0f  (%zu confirmed)\n", latencies.front(),
+           total / latencies.size(), latencies[latencies.size() / 2], latencies.back(), latencies.size());
+  }
+  const gecko_spa::LinkStats &stats = spa.get_link_stats();
+  const uint32_t *frames = stats.frames;
+  using gecko_spa::FrameKind;
+  printf("Messages:      %u status, %u config, %u parts, %u notifications, %u handshake, %u program, %u other\n",
+         frames[(size_t) FrameKind::STATUS], frames[(size_t) FrameKind::CONFIG], frames[(size_t) FrameKind::PART],
+         frames[(size_t) FrameKind::NOTIFICATION], frames[(size_t) FrameKind::HANDSHAKE],
+         frames[(size_t) FrameKind::PROGRAM], frames[(size_t) FrameKind::OTHER]);
+  printf("Link errors:   %u frame, %u reassembly, %u overflow, %u checksum, %u sequence, %u timeout, %u tx\n",
+         stats.frame_errors, stats.reassembly_errors, stats.buffer_overflows, stats.checksum_errors,
+         stats.sequence_errors, stats.reassembly_timeouts, stats.tx_errors);
+  printf("Timeouts:      %zu\n", timeouts);
+  return timeouts == 0 ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vector>
+#include "gecko_spa.h"
+
+namespace esphome {
+namespace gecko_spa {
+
+// One instance of every entity type GeckoSpa publishes to, wired up as in spa-controller.yaml
+struct HostEntities {
+  explicit HostEntities(GeckoSpa *spa) : climate(spa) {
+    static const char *const SWITCH_NAMES[6] = {"light", "circulation", "pump1", "pump2", "pump3", "pump4"};
+    for (int i = 0; i < 6; i++) {
+      switches[i].set_parent(spa);
+      switches[i].set_switch_type((SwitchType) i);
+      switches[i].set_name(SWITCH_NAMES[i]);
+    }
+    program.set_parent(spa);
+
+    all = {&climate, &waterfall, &blower, &standby, &connected, &rinse_filter, &clean_filter, &change_water,
+           &spa_checkup, &spa_time, &config_version, &status_version, &lock_mode, &pack_type, &pump_timer,
+           &program};
+    static const char *const NAMES[] = {"climate", "waterfall", "blower", "standby", "connected", "rinse_filter",
+                                        "clean_filter", "change_water", "spa_checkup", "spa_time", "config_version",
+                                        "status_version", "lock_mode", "pack_type", "pump_timer", "program"};
+    for (size_t i = 0; i < all.size(); i++)
+      all[i]->set_name(NAMES[i]);
+    for (auto &sw : switches)
+      all.push_back(&sw);
+
+    spa->set_climate(&climate);
+    spa->set_light_switch(&switches[0]);
+    spa->set_circ_switch(&switches[1]);
+    spa->set_pump1_switch(&switches[2]);
+    spa->set_pump2_switch(&switches[3]);
+    spa->set_pump3_switch(&switches[4]);
+    spa->set_pump4_switch(&switches[5]);
+    spa->set_waterfall_sensor(&waterfall);
+    spa->set_blower_sensor(&blower);
+    spa->set_standby_sensor(&standby);
+    spa->set_connected_sensor(&connected);
+    spa->set_rinse_filter_sensor(&rinse_filter);
+    spa->set_clean_filter_sensor(&clean_filter);
+    spa->set_change_water_sensor(&change_water);
+    spa->set_spa_checkup_sensor(&spa_checkup);
+    spa->set_spa_time_sensor(&spa_time);
+    spa->set_config_version_sensor(&config_version);
+    spa->set_status_version_sensor(&status_version);
+    spa->set_lock_mode_sensor(&lock_mode);
+    spa->set_pack_type_sensor(&pack_type);
+    spa->set_pump_timer_sensor(&pump_timer);
+    spa->set_program_select(&program);
+  }
+
+  void reset_counts() {
+    for (auto *entity : all)
+      entity->publish_count = 0;
+  }
+
+  GeckoSpaClimate climate;
+  GeckoSpaSwitch switches[6];  // light, circulation, pump1-4
+  binary_sensor::BinarySensor waterfall, blower, standby, connected;
+  text_sensor::TextSensor rinse_filter, clean_filter, change_water, spa_checkup, spa_time, config_version,
+      status_version, lock_mode, pack_type;
+  sensor::Sensor pump_timer;
+  GeckoSpaSelect program;
+  std::vector<EntityBase *> all;
+};
+
+}  // namespace gecko_spa
+}  // namespace esphome
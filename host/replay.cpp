@@ -0,0 +1,219 @@
+// Replays captured proxy traffic through GeckoSpa on the host and reports per-frame
+// decode latency, heap allocations and published entity updates.
+//
+// Accepted input (anything else on a line is ignored, so raw ESPHome logs work):
+//   RX:<len>:<hex>            proxy V1 lines, or frames from a dump_trace() capture
+//   FULL-RX:<n> bytes         followed by "  <offset>: <hex>" lines; fed as proxy-reassembled
+//                             messages with -m (they duplicate the RX parts in verbose logs)
+//
+// Usage: gecko_replay [-v] [-m] [-n repeat] capture.log
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "esphome/core/log.h"
+#include "gecko_spa.h"
+#include "host_entities.h"
+
+using namespace esphome;
+
+// Heap allocations made while a frame is being processed
+static bool count_allocations = false;
+static uint64_t allocations = 0;
+static uint64_t allocated_bytes = 0;
+
+void *operator new(size_t size) {
+  if (count_allocations) {
+    allocations++;
+    allocated_bytes += size;
+  }
+  void *p = malloc(size ? size : 1);
+  if (p == nullptr)
+    throw std::bad_alloc();
+  return p;
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+namespace {
+
+class ReplaySpa : public gecko_spa::GeckoSpa {
+ public:
+  void feed_line(const char *line) { process_proxy_message(line); }
+  void feed_message(const uint8_t *data, uint16_t len) {
+    process_link_frame(gecko_spa::LINK_FRAME_MSG, data, len);
+  }
+  void flush() { flush_publishes(); }  // The publish stage loop() runs
+};
+
+struct Event {
+  bool message;      // Reassembled message rather than an RX line
+  bool has_time;
+  uint32_t time_ms;  // From dump_trace() captures
+  std::string line;
+  std::vector<uint8_t> data;
+};
+
+bool is_hex(const std::string &s) {
+  return !s.empty() && std::all_of(s.begin(), s.end(), [](char c) { return isxdigit((unsigned char) c); });
+}
+
+// Number printed just before pos (dump_trace timestamp), if any
+bool time_before(const std::string &line, size_t pos, uint32_t *time_ms) {
+  size_t end = line.find_last_not_of(' ', pos == 0 ? 0 : pos - 1);
+  if (end == std::string::npos || !isdigit((unsigned char) line[end]))
+    return false;
+  size_t start = end;
+  while (start > 0 && isdigit((unsigned char) line[start - 1]))
+    start--;
+  *time_ms = strtoul(line.c_str() + start, nullptr, 10);
+  return true;
+}
+
+std::vector<Event> load_capture(const char *path, bool messages) {
+  std::vector<Event> events;
+  std::ifstream in(path);
+  std::string line;
+  Event *msg = nullptr;  // FULL-RX block being collected
+  size_t msg_len = 0;
+
+  while (std::getline(in, line)) {
+    while (!line.empty() && isspace((unsigned char) line.back()))
+      line.pop_back();
+
+    size_t full = line.find("FULL-RX:");
+    if (full != std::string::npos) {
+      msg = nullptr;
+      if (!messages)
+        continue;
+      events.push_back({});
+      msg = &events.back();
+      msg->message = true;
+      msg->has_time = time_before(line, full, &msg->time_ms);
+      msg_len = strtoul(line.c_str() + full + 8, nullptr, 10);
+      continue;
+    }
+
+    if (msg != nullptr) {
+      // "  <offset>: <hex>" continuation of a FULL-RX block
+      size_t colon = line.rfind(": ");
+      std::string hex = colon == std::string::npos ? "" : line.substr(colon + 2);
+      if (colon >= 3 && is_hex(hex) && strtoul(line.c_str() + colon - 3, nullptr, 10) == msg->data.size()) {
+        for (size_t i = 0; i + 1 < hex.size(); i += 2)
+          msg->data.push_back(strtoul(hex.substr(i, 2).c_str(), nullptr, 16));
+        if (msg->data.size() >= msg_len)
+          msg = nullptr;
+        continue;
+      }
+      msg = nullptr;
+    }
+
+    size_t rx = line.find("RX:");
+    if (rx == std::string::npos)
+      continue;
+    std::string token = line.substr(rx, line.find(' ', rx) - rx);
+    size_t sep = token.find(':', 3);
+    if (sep == std::string::npos || !is_hex(token.substr(sep + 1)))
+      continue;
+    Event ev{};
+    ev.message = false;
+    ev.has_time = time_before(line, rx, &ev.time_ms);
+    ev.line = token;
+    events.push_back(ev);
+  }
+
+  // Drop incomplete FULL-RX blocks
+  events.erase(std::remove_if(events.begin(), events.end(), [](const Event &e) { return e.message && e.data.empty(); }),
+               events.end());
+  return events;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  bool messages = false;
+  int repeat = 1;
+  const char *path = nullptr;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-v") == 0) {
+      host::log_level = ESPHOME_LOG_LEVEL_DEBUG;
+    } else if (strcmp(argv[i], "-m") == 0) {
+      messages = true;
+    } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      repeat = atoi(argv[++i]);
+    } else {
+      path = argv[i];
+    }
+  }
+  if (path == nullptr || repeat < 1) {
+    fprintf(stderr, "Usage: %s [-v] [-m] [-n repeat] capture.log\n", argv[0]);
+    return 2;
+  }
+
+  std::vector<Event> events = load_capture(path, messages);
+  if (events.empty()) {
+    fprintf(stderr, "No RX frames found in %s\n", path);
+    return 1;
+  }
+
+  ReplaySpa spa;
+  gecko_spa::HostEntities entities(&spa);
+  spa.setup();
+  entities.reset_counts();
+  spa.tx_writes = 0;
+  spa.tx_data.clear();
+
+  std::vector<double> latency_us;
+  latency_us.reserve(events.size() * repeat);
+  size_t rx_lines = 0, reassembled = 0;
+  for (int r = 0; r < repeat; r++) {
+    for (const Event &ev : events) {
+      if (ev.has_time)
+        host::set_millis(ev.time_ms);
+      else
+        host::advance_millis(10);
+
+      count_allocations = true;
+      auto start = std::chrono::steady_clock::now();
+      if (ev.message)
+        spa.feed_message(ev.data.data(), ev.data.size());
+      else
+        spa.feed_line(ev.line.c_str());
+      spa.flush();
+      auto end = std::chrono::steady_clock::now();
+      count_allocations = false;
+
+      latency_us.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+      (ev.message ? reassembled : rx_lines)++;
+    }
+  }
+
+  std::vector<double> sorted = latency_us;
+  std::sort(sorted.begin(), sorted.end());
+  double total = 0;
+  for (double v : sorted)
+    total += v;
+  auto pct = [&](double p) { return sorted[std::min(sorted.size() - 1, (size_t) (p * sorted.size()))]; };
+
+  printf("Frames:        %zu (%zu RX lines, %zu reassembled messages) x %d\n", events.size(),
+         rx_lines / repeat, reassembled / repeat, repeat);
+  printf("Latency (us):  min %.2f  avg %.2f  p50 %.2f  p99 %.2f  max %.2f\n", sorted.front(),
+         total / sorted.size(), pct(0.50), pct(0.99), sorted.back());
+  printf("Allocations:   %llu (%llu bytes), %.3f per frame\n", (unsigned long long) allocations,
+         (unsigned long long) allocated_bytes, (double) allocations / sorted.size());
+  printf("UART writes:   %u (%zu bytes)\n", spa.tx_writes, spa.tx_data.size());
+  printf("Entity updates:\n");
+  for (auto *entity : entities.all) {
+    if (entity->publish_count > 0)
+      printf("  %-16s %u\n", entity->get_name().c_str(), entity->publish_count);
+  }
+  return 0;
+}
@@ -0,0 +1,486 @@
+// Simulated spa and Arduino proxy on a pseudo-terminal, speaking the V1 proxy protocol
+// (I2C_PROXY:V1, READY, RX:/TX:, PONG). Point the ESP32 firmware's UART or gecko_link
+// at the printed device to exercise the real receive path without hardware.
+//
+// The spa answers GO with the handshake (two 33-byte XML names, 22-byte clock, LO),
+// waiting for each ACK, sends 3-part status bursts and 77-byte notifications at
+// configurable rates, and applies FRQ writes and program commands to its state. Config
+// writes are answered with a config+status message. Status and config parts can be
+// dropped or corrupted at a fixed rate to exercise reassembly recovery.
+//
+// Usage: spa_sim [--link path] [--status-ms 1000] [--notify-ms 60000] [--response-ms 50]
+//                [--drop-every n] [--corrupt-every n]
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+namespace {
+
+volatile sig_atomic_t running = 1;
+void stop(int) { running = 0; }
+
+uint32_t now_ms() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint8_t checksum(const std::vector<uint8_t> &msg) {
+  uint8_t x = 0;
+  for (size_t i = 0; i + 1 < msg.size(); i++)
+    x ^= msg[i];
+  return x;
+}
+
+// Geckolib address space: config struct at 0-255, status (log) struct from 256
+const uint16_t CFG_SETPOINT = 1;       // SetpointG (word)
+const uint16_t LOG_UD_PUMPS = 259;     // UdP1-UdP4, 2 bits each
+const uint16_t LOG_DEVICES = 260;      // BL bit 1, CP bit 2, MSTR_HEATER bit 5
+const uint16_t LOG_PUMPS = 261;        // P1-P4, 2 bits each
+const uint16_t LOG_SETPOINT = 275;     // RealSetPointG (word)
+const uint16_t LOG_WATER_TEMP = 277;   // DisplayedTempG (word)
+const uint16_t LOG_PACK_TYPE = 289;
+const uint16_t LOG_UD_LIGHT = 307;     // UdLi
+const uint16_t LOG_UD_CIRC = 363;      // Written by the circulation command
+const uint16_t STATUS_BASE = 254;      // Status message byte = geckolib offset - 254
+const uint16_t STATUS_LEN = 162;
+const uint16_t CONFIG_LEN = 226;       // Config section of a config+status message
+
+class SpaSim {
+ public:
+  explicit SpaSim(int fd) : fd_(fd) {
+    set_word(CFG_SETPOINT, 37 * 18);
+    set_word(LOG_SETPOINT, 37 * 18);
+    set_word(LOG_WATER_TEMP, 36 * 18);
+    mem_[LOG_PACK_TYPE] = 10;  // inYT
+  }
+
+  uint32_t status_ms{1000};
+  uint32_t notify_ms{60000};
+  uint32_t response_ms{50};
+  uint32_t drop_every{0};     // Drop every nth message part, 0 = never
+  uint32_t corrupt_every{0};  // Flip a bit in every nth message part, 0 = never
+
+  void boot() {
+    send_line("I2C_PROXY:V1");
+    send_line("READY");
+  }
+
+  void poll_input() {
+    uint8_t buf[256];
+    ssize_t n = read(fd_, buf, sizeof(buf));
+    for (ssize_t i = 0; i < n; i++) {
+      char c = buf[i];
+      if (c == '\n' || c == '\r') {
+        if (!line_.empty())
+          handle_line(line_);
+        line_.clear();
+      } else if (line_.size() < 600) {
+        line_ += c;
+      }
+    }
+  }
+
+  void tick() {
+    uint32_t now = now_ms();
+    if (handshake_step_ > 0 && now - handshake_sent_ >= 200) {
+      fprintf(stderr, "%8u handshake step %d not acknowledged, continuing\n", now, handshake_step_);
+      next_handshake_message();
+    }
+    if (status_due_ != 0 && (int32_t) (now - status_due_) >= 0) {
+      status_due_ = 0;
+      send_status();
+    }
+    if (config_due_ != 0 && (int32_t) (now - config_due_) >= 0) {
+      config_due_ = 0;
+      send_config();
+    }
+    if (program_due_ != 0 && (int32_t) (now - program_due_) >= 0) {
+      program_due_ = 0;
+      send_program_status();
+    }
+    if (now - last_status_ >= status_ms)
+      send_status();
+    if (now - last_notify_ >= notify_ms) {
+      last_notify_ = now;
+      send_notification();
+    }
+  }
+
+  void print_summary() {
+    fprintf(stderr, "\nHandshakes: %u", handshakes_);
+    if (handshakes_ > 0)
+      fprintf(stderr, " (avg %.1f ms, max %u ms GO to LO)", (double) handshake_total_ms_ / handshakes_,
+              handshake_max_ms_);
+    fprintf(stderr, "\nStatus bursts: %u, config messages: %u, notifications: %u\n", status_bursts_,
+            config_messages_, notifications_);
+    fprintf(stderr, "Commands applied: %u, bad checksums: %u\n", commands_, bad_checksums_);
+    if (drop_every != 0 || corrupt_every != 0)
+      fprintf(stderr, "Message parts: %u sent, %u dropped, %u corrupted\n", parts_sent_, dropped_parts_,
+              corrupted_parts_);
+    fprintf(stderr, "UART bytes sent: %llu\n", (unsigned long long) bytes_sent_);
+  }
+
+ protected:
+  void send_line(const std::string &line) {
+    std::string out = line + "\n";
+    if (write(fd_, out.data(), out.size()) > 0)
+      bytes_sent_ += out.size();
+  }
+
+  // Forward an I2C message from the spa, as the proxy does
+  void send_hex(const std::vector<uint8_t> &msg) {
+    static const char HEX[] = "0123456789ABCDEF";
+    std::string line = "RX:" + std::to_string(msg.size()) + ":";
+    for (uint8_t b : msg) {
+      line += HEX[b >> 4];
+      line += HEX[b & 0x0F];
+    }
+    send_line(line);
+  }
+
+  void send_rx(std::vector<uint8_t> msg) {
+    msg.back() = checksum(msg);
+    send_hex(msg);
+  }
+
+  static std::vector<uint8_t> header(uint8_t type, size_t len) {
+    std::vector<uint8_t> msg(len, 0);
+    const uint8_t h[7] = {0x17, 0x09, 0x00, 0x00, 0x00, 0x17, type};
+    memcpy(msg.data(), h, sizeof(h));
+    return msg;
+  }
+
+  void set_word(uint16_t pos, uint16_t value) {
+    mem_[pos] = value >> 8;
+    mem_[pos + 1] = value & 0xFF;
+  }
+  uint16_t word(uint16_t pos) const { return (mem_[pos] << 8) | mem_[pos + 1]; }
+
+  void handle_line(const std::string &line) {
+    if (line == "PING") {
+      send_line("PONG");
+      return;
+    }
+    if (line.compare(0, 3, "TX:") != 0)
+      return;  // MODE:, DEDUP:, ACK: are unknown to a V1 proxy
+    std::vector<uint8_t> msg;
+    for (size_t i = 3; i + 1 < line.size(); i += 2)
+      msg.push_back(strtoul(line.substr(i, 2).c_str(), nullptr, 16));
+    // Latency as a real proxy reports it: roughly the bus time at 100 kHz
+    send_line("TX:OK:" + std::to_string((msg.size() + 4) * 90));
+    if (msg.size() >= 15)
+      handle_i2c(msg);
+  }
+
+  void handle_i2c(const std::vector<uint8_t> &msg) {
+    uint32_t now = now_ms();
+    // GO keep-alive starts the handshake
+    if (msg.size() == 15 && msg[13] == 'G' && msg[14] == 'O') {
+      if (handshake_step_ == 0) {
+        handshake_start_ = now;
+        next_handshake_message();
+      }
+      return;
+    }
+    // ACK of the previous handshake message
+    if (msg.size() == 15 && msg[12] == 0x01 && msg[13] == 0x00 && msg[14] == 0x02) {
+      if (handshake_step_ > 0)
+        next_handshake_message();
+      return;
+    }
+    // GO, LO and ACK end in fixed bytes; everything else carries an XOR checksum
+    if (checksum(msg) != msg.back()) {
+      bad_checksums_++;
+      fprintf(stderr, "%8u bad checksum on %zu-byte command\n", now, msg.size());
+      return;
+    }
+    // FRQ write: ... [13..15]="FRQ" [16..17]=offset [18..]=data
+    if (msg.size() >= 20 && msg[13] == 'F' && msg[14] == 'R' && msg[15] == 'Q') {
+      uint16_t offset = (msg[16] << 8) | msg[17];
+      for (size_t i = 18; i + 1 < msg.size() && offset < sizeof(mem_); i++)
+        mem_[offset++] = msg[i];
+      apply_write((msg[16] << 8) | msg[17]);
+      return;
+    }
+    // Program select: ... 04 4E 03 D0 [PROG]
+    if (msg.size() == 18 && msg[13] == 0x4E && msg[15] == 0xD0) {
+      program_ = msg[16];
+      commands_++;
+      fprintf(stderr, "%8u program %d\n", now, program_);
+      program_due_ = schedule_response();
+      return;
+    }
+  }
+
+  // Derive the device state the ESP reads back from a user demand write
+  void apply_write(uint16_t offset) {
+    commands_++;
+    if (offset == CFG_SETPOINT) {
+      set_word(LOG_SETPOINT, word(CFG_SETPOINT));
+    } else if (offset == LOG_UD_CIRC) {
+      mem_[LOG_DEVICES] = (mem_[LOG_DEVICES] & ~0x04) | (mem_[LOG_UD_CIRC] ? 0x04 : 0);
+    } else if (offset == LOG_UD_PUMPS) {
+      // UdPn HI (2) runs the pump HIGH (1), LO (1) runs it LOW (2)
+      uint8_t pumps = 0;
+      for (int i = 0; i < 4; i++) {
+        uint8_t ud = (mem_[LOG_UD_PUMPS] >> (2 * i)) & 0x03;
+        pumps |= (ud == 2 ? 1 : ud == 1 ? 2 : 0) << (2 * i);
+      }
+      mem_[LOG_PUMPS] = pumps;
+    }
+    fprintf(stderr, "%8u write 0x%04X: light=%d circ=%d pumps=%02X setpoint=%.1f\n", now_ms(), offset,
+            mem_[LOG_UD_LIGHT], (mem_[LOG_DEVICES] >> 2) & 1, mem_[LOG_PUMPS], word(LOG_SETPOINT) / 18.0);
+    if (offset < STATUS_BASE) {
+      config_due_ = schedule_response();
+    } else {
+      status_due_ = schedule_response();
+    }
+  }
+
+  // Time to answer a command at; 0 means nothing is due
+  uint32_t schedule_response() const {
+    uint32_t due = now_ms() + response_ms;
+    return due != 0 ? due : 1;
+  }
+
+  void send_program_status() {
+    std::vector<uint8_t> msg = header(0x0B, 18);
+    const uint8_t body[4] = {0x04, 0x4E, 0x03, 0xD0};
+    memcpy(&msg[12], body, sizeof(body));
+    msg[16] = program_;
+    send_rx(msg);
+  }
+
+  void next_handshake_message() {
+    uint32_t now = now_ms();
+    handshake_sent_ = now;
+    switch (handshake_step_++) {
+      case 0:
+        send_xml("inYT_C65.xml");
+        break;
+      case 1:
+        send_xml("inYT_S65.xml");
+        break;
+      case 2: {
+        time_t t = time(nullptr);
+        struct tm tm;
+        localtime_r(&t, &tm);
+        std::vector<uint8_t> msg = header(0x0A, 22);
+        msg[12] = 0x07;
+        msg[13] = 'K';
+        msg[15] = tm.tm_mday;
+        msg[16] = tm.tm_mon + 1;
+        msg[17] = tm.tm_wday;
+        msg[18] = tm.tm_hour;
+        msg[19] = tm.tm_min;
+        msg[20] = tm.tm_sec;
+        send_rx(msg);
+        break;
+      }
+      default: {
+        std::vector<uint8_t> msg = header(0x0A, 15);
+        msg[12] = 0x01;
+        msg[13] = 'L';
+        msg[14] = 'O';
+        send_hex(msg);
+        handshake_step_ = 0;
+        uint32_t took = now - handshake_start_;
+        handshakes_++;
+        handshake_total_ms_ += took;
+        if (took > handshake_max_ms_)
+          handshake_max_ms_ = took;
+        fprintf(stderr, "%8u handshake complete in %u ms\n", now, took);
+        break;
+      }
+    }
+  }
+
+  void send_xml(const char *name) {
+    std::vector<uint8_t> msg = header(0x0A, 33);
+    msg[12] = 0x12;
+    memcpy(&msg[16], name, strlen(name));
+    send_rx(msg);
+  }
+
+  void send_status() {
+    last_status_ = now_ms();
+    // Water drifts towards the setpoint, heating while below it
+    uint16_t water = word(LOG_WATER_TEMP), target = word(LOG_SETPOINT);
+    bool heating = water < target;
+    mem_[LOG_DEVICES] = (mem_[LOG_DEVICES] & ~0x20) | (heating ? 0x20 : 0);
+    if (water != target)
+      set_word(LOG_WATER_TEMP, heating ? water + 1 : water - 1);
+
+    send_parts(std::vector<uint8_t>(&mem_[STATUS_BASE], &mem_[STATUS_BASE + STATUS_LEN]));
+    status_bursts_++;
+  }
+
+  // Config+status message: two header bytes, the config section, a 0x3B marker and the
+  // status message
+  void send_config() {
+    last_status_ = now_ms();
+    std::vector<uint8_t> body(2, 0);
+    body.insert(body.end(), &mem_[0], &mem_[CONFIG_LEN]);
+    body.push_back(0x3B);
+    body.insert(body.end(), &mem_[STATUS_BASE], &mem_[STATUS_BASE + STATUS_LEN]);
+    send_parts(body);
+    config_messages_++;
+  }
+
+  // Split a message into 62-byte parts, the last one shorter
+  void send_parts(const std::vector<uint8_t> &body) {
+    for (size_t offset = 0; offset < body.size(); offset += 62) {
+      size_t part = std::min<size_t>(62, body.size() - offset);
+      std::vector<uint8_t> msg = header(0x0A, 16 + part);
+      msg[7] = 0x01;
+      msg[9] = offset + part < body.size() ? 0x01 : 0x00;  // More parts follow
+      msg[14] = 0x52;
+      msg[15] = 0x51;
+      memcpy(&msg[16], &body[offset], part);
+      parts_sent_++;
+      if (drop_every != 0 && parts_sent_ % drop_every == 0) {
+        dropped_parts_++;
+        continue;
+      }
+      msg.back() = checksum(msg);
+      if (corrupt_every != 0 && parts_sent_ % corrupt_every == 0) {
+        msg[20] ^= 0x10;
+        corrupted_parts_++;
+      }
+      send_hex(msg);
+    }
+  }
+
+  void send_notification() {
+    time_t t = time(nullptr) - 10 * 86400;
+    struct tm tm;
+    localtime_r(&t, &tm);
+    std::vector<uint8_t> msg = header(0x0B, 77);
+    static const uint16_t INTERVALS[4] = {30, 60, 90, 365};
+    for (int i = 0; i < 4; i++) {
+      uint8_t *entry = &msg[16 + i * 6];
+      entry[0] = i + 1;
+      entry[1] = tm.tm_mday;
+      entry[2] = tm.tm_mon + 1;
+      entry[3] = tm.tm_year % 100;
+      entry[4] = INTERVALS[i] & 0xFF;
+      entry[5] = INTERVALS[i] >> 8;
+    }
+    send_rx(msg);
+    notifications_++;
+  }
+
+  int fd_;
+  std::string line_;
+  uint8_t mem_[512]{};
+  uint8_t program_{1};
+  uint32_t last_status_{0};
+  uint32_t last_notify_{0};
+  uint32_t status_due_{0};
+  uint32_t config_due_{0};
+  uint32_t program_due_{0};
+  int handshake_step_{0};
+  uint32_t handshake_start_{0};
+  uint32_t handshake_sent_{0};
+  uint32_t handshakes_{0};
+  uint64_t handshake_total_ms_{0};
+  uint32_t handshake_max_ms_{0};
+  uint32_t status_bursts_{0};
+  uint32_t config_messages_{0};
+  uint32_t notifications_{0};
+  uint32_t commands_{0};
+  uint32_t bad_checksums_{0};
+  uint32_t parts_sent_{0};
+  uint32_t dropped_parts_{0};
+  uint32_t corrupted_parts_{0};
+  uint64_t bytes_sent_{0};
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const char *link = nullptr;
+  uint32_t status_ms = 1000, notify_ms = 60000, response_ms = 50, drop_every = 0, corrupt_every = 0;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--link") == 0) {
+      link = argv[i + 1];
+    } else if (strcmp(argv[i], "--status-ms") == 0) {
+      status_ms = atoi(argv[i + 1]);
+    } else if (strcmp(argv[i], "--notify-ms") == 0) {
+      notify_ms = atoi(argv[i + 1]);
+    } else if (strcmp(argv[i], "--response-ms") == 0) {
+      response_ms = atoi(argv[i + 1]);
+    } else if (strcmp(argv[i], "--drop-every") == 0) {
+      drop_every = atoi(argv[i + 1]);
+    } else if (strcmp(argv[i], "--corrupt-every") == 0) {
+      corrupt_every = atoi(argv[i + 1]);
+    } else {
+      fprintf(stderr,
+              "Usage: %s [--link path] [--status-ms n] [--notify-ms n] [--response-ms n] [--drop-every n] "
+              "[--corrupt-every n]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+    perror("posix_openpt");
+    return 1;
+  }
+  const char *slave_name = ptsname(master);
+  // Keep the slave open in raw mode so settings persist and reads never see a hangup
+  int slave = open(slave_name, O_RDWR | O_NOCTTY);
+  struct termios tio;
+  tcgetattr(slave, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(slave, TCSANOW, &tio);
+  fcntl(master, F_SETFL, O_NONBLOCK);
+
+  if (link != nullptr) {
+    unlink(link);
+    if (symlink(slave_name, link) != 0) {
+      perror("symlink");
+      return 1;
+    }
+  }
+  printf("%s\n", slave_name);
+  fflush(stdout);
+
+  signal(SIGINT, stop);
+  signal(SIGTERM, stop);
+
+  SpaSim sim(master);
+  sim.status_ms = status_ms;
+  sim.notify_ms = notify_ms;
+  sim.response_ms = response_ms;
+  sim.drop_every = drop_every;
+  sim.corrupt_every = corrupt_every;
+  sim.boot();
+  while (running) {
+    struct pollfd pfd = {master, POLLIN, 0};
+    poll(&pfd, 1, 5);
+    sim.poll_input();
+    sim.tick();
+  }
+  sim.print_summary();
+
+  if (link != nullptr)
+    unlink(link);
+  close(slave);
+  close(master);
+  return 0;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace binary_sensor {
+
+class BinarySensor : public EntityBase {
+ public:
+  void publish_state(bool new_state);
+  bool state{false};
+};
+
+}  // namespace binary_sensor
+}  // namespace esphome
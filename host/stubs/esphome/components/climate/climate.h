@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cmath>
+#include <set>
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace climate {
+
+enum ClimateMode : uint8_t { CLIMATE_MODE_OFF, CLIMATE_MODE_HEAT_COOL, CLIMATE_MODE_COOL, CLIMATE_MODE_HEAT };
+enum ClimateAction : uint8_t { CLIMATE_ACTION_OFF, CLIMATE_ACTION_COOLING, CLIMATE_ACTION_HEATING, CLIMATE_ACTION_IDLE };
+
+class ClimateTraits {
+ public:
+  void set_supports_current_temperature(bool supports) {}
+  void set_supported_modes(std::set<ClimateMode> modes) {}
+  void set_supports_action(bool supports) {}
+  void set_visual_min_temperature(float temp) {}
+  void set_visual_max_temperature(float temp) {}
+  void set_visual_temperature_step(float step) {}
+};
+
+class ClimateCall {
+ public:
+  const optional<float> &get_target_temperature() const { return target_temperature_; }
+  optional<float> target_temperature_;
+};
+
+class Climate : public EntityBase {
+ public:
+  void publish_state();
+
+  ClimateMode mode{CLIMATE_MODE_OFF};
+  ClimateAction action{CLIMATE_ACTION_OFF};
+  float target_temperature{NAN};
+  float current_temperature{NAN};
+
+ protected:
+  virtual ClimateTraits traits() = 0;
+  virtual void control(const ClimateCall &call) = 0;
+};
+
+}  // namespace climate
+}  // namespace esphome
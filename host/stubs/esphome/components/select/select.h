@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace select {
+
+class Select : public EntityBase {
+ public:
+  void publish_state(const std::string &new_state);
+  std::string state;
+
+ protected:
+  virtual void control(const std::string &value) = 0;
+};
+
+}  // namespace select
+}  // namespace esphome
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace sensor {
+
+class Sensor : public EntityBase {
+ public:
+  void publish_state(float new_state);
+  float state{0};
+};
+
+}  // namespace sensor
+}  // namespace esphome
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace switch_ {
+
+class Switch : public EntityBase {
+ public:
+  void publish_state(bool new_state);
+  bool state{false};
+
+ protected:
+  virtual void write_state(bool state) = 0;
+};
+
+}  // namespace switch_
+}  // namespace esphome
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace text_sensor {
+
+class TextSensor : public EntityBase {
+ public:
+  void publish_state(const std::string &new_state);
+  std::string state;
+};
+
+}  // namespace text_sensor
+}  // namespace esphome
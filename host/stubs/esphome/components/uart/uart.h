@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace esphome {
+namespace uart {
+
+class UARTComponent {};
+
+// Host build: reads come from rx_data, writes are collected in tx_data
+class UARTDevice {
+ public:
+  void set_uart_parent(UARTComponent *parent) {}
+
+  int available() { return rx_data.size() - rx_pos; }
+  uint8_t read() { return rx_data[rx_pos++]; }
+  bool read_array(uint8_t *data, size_t len);
+  void write_array(const uint8_t *data, size_t len);
+  void write_str(const char *str) { write_array((const uint8_t *) str, strlen(str)); }
+
+  std::vector<uint8_t> rx_data;
+  size_t rx_pos{0};
+  std::vector<uint8_t> tx_data;
+  uint32_t tx_writes{0};
+};
+
+}  // namespace uart
+}  // namespace esphome
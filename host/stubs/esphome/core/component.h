@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include "esphome/core/hal.h"
+
+namespace esphome {
+
+namespace setup_priority {
+const float DATA = 600.0f;
+const float PROCESSOR = 400.0f;
+const float LATE = -100.0f;
+}  // namespace setup_priority
+
+class Component {
+ public:
+  virtual ~Component() = default;
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+  virtual void on_safe_shutdown() {}
+  virtual float get_setup_priority() const { return setup_priority::DATA; }
+  void set_interval(uint32_t interval, std::function<void()> &&f) {}
+};
+
+class PollingComponent : public Component {};
+
+// Entities count their state publications so host tools can report them
+class EntityBase {
+ public:
+  void set_name(const char *name) { name_ = name; }
+  const std::string &get_name() const { return name_; }
+  uint32_t get_object_id_hash() const { return std::hash<std::string>{}(name_); }
+
+  uint32_t publish_count{0};
+
+ protected:
+  std::string name_;
+};
+
+}  // namespace esphome
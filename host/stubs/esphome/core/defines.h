@@ -0,0 +1,2 @@
+#pragma once
+// Host build: component options are passed as compiler definitions instead (see host/CMakeLists.txt)
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace esphome {
+
+class GPIOPin {
+ public:
+  virtual ~GPIOPin() = default;
+  virtual void setup() {}
+  virtual void digital_write(bool value) {}
+};
+
+}  // namespace esphome
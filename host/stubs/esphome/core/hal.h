@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+
+namespace host {
+// Host build clock for millis(), only moves when set or advanced. micros() is real time.
+void set_millis(uint32_t ms);
+void advance_millis(uint32_t ms);
+}  // namespace host
+
+}  // namespace esphome
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+namespace esphome {
+
+template<typename T> using optional = std::optional<T>;
+
+class Mutex {
+ public:
+  void lock() { mutex_.lock(); }
+  bool try_lock() { return mutex_.try_lock(); }
+  void unlock() { mutex_.unlock(); }
+
+ protected:
+  std::mutex mutex_;
+};
+
+class LockGuard {
+ public:
+  LockGuard(Mutex &mutex) : mutex_(mutex) { mutex_.lock(); }
+  ~LockGuard() { mutex_.unlock(); }
+
+ protected:
+  Mutex &mutex_;
+};
+
+inline uint32_t fnv1_hash(const char *str) {
+  uint32_t hash = 2166136261UL;
+  for (; *str; str++) {
+    hash *= 16777619UL;
+    hash ^= (uint8_t) *str;
+  }
+  return hash;
+}
+
+}  // namespace esphome
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <vector>
+
+namespace esphome {
+
+// Host build: preferences live in memory for the life of the process
+class ESPPreferenceObject {
+ public:
+  ESPPreferenceObject() = default;
+  explicit ESPPreferenceObject(std::vector<uint8_t> *data) : data_(data) {}
+
+  template<typename T> bool save(const T *src) {
+    if (data_ == nullptr)
+      return false;
+    data_->assign((const uint8_t *) src, (const uint8_t *) src + sizeof(T));
+    return true;
+  }
+  template<typename T> bool load(T *dest) {
+    if (data_ == nullptr || data_->size() != sizeof(T))
+      return false;
+    memcpy(dest, data_->data(), sizeof(T));
+    return true;
+  }
+
+ protected:
+  std::vector<uint8_t> *data_{nullptr};
+};
+
+class ESPPreferences {
+ public:
+  template<typename T> ESPPreferenceObject make_preference(uint32_t type, bool in_flash = false) {
+    return ESPPreferenceObject(&store_[type]);
+  }
+
+ protected:
+  std::map<uint32_t, std::vector<uint8_t>> store_;
+};
+
+extern ESPPreferences *global_preferences;
+
+}  // namespace esphome
@@ -0,0 +1,93 @@
+// Host implementations of the ESPHome stand-ins used by the gecko_spa component
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "esphome/core/preferences.h"
+#include "esphome/components/binary_sensor/binary_sensor.h"
+#include "esphome/components/climate/climate.h"
+#include "esphome/components/select/select.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/components/switch/switch.h"
+#include "esphome/components/text_sensor/text_sensor.h"
+#include "esphome/components/uart/uart.h"
+
+namespace esphome {
+
+static uint32_t clock_ms = 0;
+
+uint32_t millis() { return clock_ms; }
+// Real time, so the component's loop() timing measures actual cost
+uint32_t micros() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+void delay(uint32_t ms) { clock_ms += ms; }
+
+namespace host {
+int log_level = ESPHOME_LOG_LEVEL_WARN;
+void set_millis(uint32_t ms) { clock_ms = ms; }
+void advance_millis(uint32_t ms) { clock_ms += ms; }
+}  // namespace host
+
+void esp_log_printf_(int level, const char *tag, int line, const char *format, ...) {
+  if (level > host::log_level)
+    return;
+  static const char LEVELS[] = "?EWICDVV";
+  fprintf(stderr, "[%c][%s:%03d]: ", LEVELS[level], tag, line);
+  va_list args;
+  va_start(args, format);
+  vfprintf(stderr, format, args);
+  va_end(args);
+  fputc('\n', stderr);
+}
+
+static ESPPreferences host_preferences;
+ESPPreferences *global_preferences = &host_preferences;
+
+namespace uart {
+
+bool UARTDevice::read_array(uint8_t *data, size_t len) {
+  if (rx_pos + len > rx_data.size())
+    return false;
+  memcpy(data, rx_data.data() + rx_pos, len);
+  rx_pos += len;
+  return true;
+}
+
+void UARTDevice::write_array(const uint8_t *data, size_t len) {
+  tx_data.insert(tx_data.end(), data, data + len);
+  tx_writes++;
+}
+
+}  // namespace uart
+
+void binary_sensor::BinarySensor::publish_state(bool new_state) {
+  state = new_state;
+  publish_count++;
+}
+
+void sensor::Sensor::publish_state(float new_state) {
+  state = new_state;
+  publish_count++;
+}
+
+void text_sensor::TextSensor::publish_state(const std::string &new_state) {
+  state = new_state;
+  publish_count++;
+}
+
+void switch_::Switch::publish_state(bool new_state) {
+  state = new_state;
+  publish_count++;
+}
+
+void select::Select::publish_state(const std::string &new_state) {
+  state = new_state;
+  publish_count++;
+}
+
+void climate::Climate::publish_state() { publish_count++; }
+
+}  // namespace esphome
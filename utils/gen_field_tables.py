@@ -0,0 +1,261 @@
+"""Generate constexpr C++ field descriptor tables from the geckolib struct definitions.
+
+Usage (from the utils directory):
+    python gen_field_tables.py log > ../components/gecko_spa/gecko_log_fields.h
+    python gen_field_tables.py config > ../components/gecko_spa/gecko_config_fields.h
+    python gen_field_tables.py layouts > ../components/gecko_spa/gecko_layouts.h
+
+Each accessor in config/inyt-log-65.py (or inyt-cfg-65.py) becomes one FieldDesc
+entry, decoded at runtime by the generic loop in gecko_fields.h.  Entries are
+sorted by position so that consecutive fields cover consecutive message bytes.
+The layout registry maps the pack and version in the handshake XML names to these
+tables and to where their sections sit in the messages.
+"""
+
+import importlib
+import sys
+
+from config import (
+    GeckoBoolStructAccessor,
+    GeckoByteStructAccessor,
+    GeckoEnumStructAccessor,
+    GeckoTempStructAccessor,
+    GeckoTimeStructAccessor,
+    GeckoWordStructAccessor,
+)
+
+# (module, class, C++ enum name, C++ table prefix)
+LOG_STRUCT = ("inyt-log-65", "GeckoLogStruct", "LogField", "LOG")
+CONFIG_STRUCT = ("inyt-cfg-65", "GeckoConfigStruct", "ConfigField", "CONFIG")
+
+# decoder.py maps inYT config section bytes to v65 struct positions piecewise: bytes
+# 64 to 166 hold struct positions 61 to 163 (its -3 from index 64), and the mapping
+# changes again further on. Only that first range is reproduced here: fields from
+# struct position 61 sit three bytes later in the message.
+CONFIG_POSITION_SHIFTS = [(61, 3)]
+# Last message position whose field decoder.py agrees on. The fields placed past it
+# are decoded but not writable, a write there could land on a different setting.
+CONFIG_WRITABLE_END = 163
+
+# Value names seen on real packs where the geckolib list has gaps
+VALUE_OVERRIDES = {
+    "SilentMode": ["NA", "OFF", "ECONOMY", "SLEEP", "NIGHT"],
+}
+
+# Older inYT status versions (<= 50) only have a handful of known positions.
+# Fields listed here keep their v65 bit layout at the given position; all
+# other fields are marked unavailable for that version.
+LOG_V50_POSITIONS = {
+    "Hours": 284,
+    "QuietState": 285,
+    "UdP1": 258,
+    "UdP2": 258,
+    "UdP3": 258,
+    "UdP4": 258,
+    "BL": 259,
+    "CP": 259,
+    "MSTR_HEATER": 259,
+    "Waterfall": 259,
+    "P1": 260,
+    "P2": 260,
+    "P3": 260,
+    "P4": 260,
+    "UdLi": 307,
+    "RealSetPointG": 274,
+    "DisplayedTempG": 276,
+    "LockMode": 309,
+    "PackType": 288,
+    "UdPumpTime": 302,
+}
+
+# Layout registry: (pack, kind, min version, max version, table, status message length).
+# The status length is what the pack sends, which runs past the bytes the struct covers;
+# 0 leaves it to be detected from traffic; only list a length for the versions it was
+# seen on, since it varies with pack and version. The first layout of each kind is the
+# default until the handshake names one.
+LAYOUTS = [
+    ("inYT", "C", 0, 255, "CONFIG_FIELDS_V65", None),
+    ("inYT", "S", 65, 65, "LOG_FIELDS_V65", 162),
+    ("inYT", "S", 51, 255, "LOG_FIELDS_V65", 0),
+    ("inYT", "S", 0, 50, "LOG_FIELDS_V50", 0),
+]
+
+
+def enum_values(tag, accessor):
+    if not isinstance(accessor, GeckoEnumStructAccessor):
+        return None
+    return VALUE_OVERRIDES.get(tag, accessor.values)
+
+
+def field_layout(accessor):
+    """Return (FieldType, shift, mask) for an accessor."""
+    if isinstance(accessor, GeckoBoolStructAccessor):
+        return "BOOL", accessor.bit, 0x01
+    if isinstance(accessor, GeckoEnumStructAccessor):
+        shift = accessor.bitpos or 0
+        mask = (accessor.maxitems - 1) if accessor.maxitems else 0xFF
+        return "ENUM", shift, mask
+    if isinstance(accessor, GeckoByteStructAccessor):
+        return "BYTE", 0, 0xFF
+    if isinstance(accessor, GeckoTempStructAccessor):
+        return "TEMP", 0, 0xFF
+    if isinstance(accessor, GeckoTimeStructAccessor):
+        return "TIME", 0, 0xFF
+    if isinstance(accessor, GeckoWordStructAccessor):
+        return "WORD", 0, 0xFF
+    raise ValueError(f"Unsupported accessor {accessor!r}")
+
+
+def load_accessors(module, classname):
+    struct_class = importlib.import_module("config." + module)
+    instance = getattr(struct_class, classname)(None)
+    accessors = list(instance.accessors.items())
+    accessors.sort(key=lambda item: (item[1].position, field_layout(item[1])[1], item[0]))
+    return accessors
+
+
+def shifted_position(pos, shifts):
+    for start, delta in shifts:
+        if pos >= start:
+            pos += delta
+    return pos
+
+
+def struct_end(accessors, shifts=()):
+    return max(
+        shifted_position(a.position, shifts)
+        + (2 if field_layout(a)[0] in ("WORD", "TEMP", "TIME") else 1)
+        for _, a in accessors
+    )
+
+
+def emit_layouts():
+    out = [
+        "// Generated by utils/gen_field_tables.py - do not edit.",
+        "#pragma once",
+        "",
+        '#include "gecko_config_fields.h"',
+        '#include "gecko_log_fields.h"',
+        '#include "message_layout.h"',
+        "",
+        "namespace esphome {",
+        "namespace gecko_spa {",
+        "",
+        "static constexpr MessageLayout MESSAGE_LAYOUTS[] = {",
+    ]
+    defaults = {}
+    for index, (pack, kind, min_version, max_version, table, status_len) in enumerate(LAYOUTS):
+        if kind == "C":
+            placement = "0, CFG_OFFSET, CONFIG_STRUCT_LEN"
+        else:
+            placement = f"LOG_MSG_BASE, 0, {status_len}"
+        out.append(f'    {{"{pack}", \'{kind}\', {min_version}, {max_version}, {table}, {placement}}},')
+        defaults.setdefault(kind, index)
+    out.append("};")
+    out.append("")
+    for kind, name in (("C", "CONFIG"), ("S", "STATUS")):
+        out.append(
+            f"static constexpr const MessageLayout *DEFAULT_{name}_LAYOUT = "
+            f"&MESSAGE_LAYOUTS[{defaults[kind]}];"
+        )
+    out.append("")
+    out.append("}  // namespace gecko_spa")
+    out.append("}  // namespace esphome")
+    sys.stdout.write("\n".join(out) + "\n")
+
+
+def emit_table(out, name, accessors, value_names, positions=None, shifts=(), writable_end=None):
+    out.append(f"static constexpr FieldDesc {name}[] = {{")
+    for tag, accessor in accessors:
+        field_type, shift, mask = field_layout(accessor)
+        pos = shifted_position(accessor.position, shifts)
+        if positions is not None:
+            if tag in positions:
+                pos = positions[tag]
+            else:
+                field_type, pos = "NONE", 0
+        values = "nullptr"
+        num_values = 0
+        if enum_values(tag, accessor):
+            values = value_names[tuple(enum_values(tag, accessor))]
+            num_values = len(enum_values(tag, accessor))
+        writable = "true" if accessor.access == "ALL" else "false"
+        if writable_end is not None and pos > writable_end:
+            writable = "false"
+        out.append(
+            f'    {{"{tag}", {values}, {pos}, FieldType::{field_type}, '
+            f"{shift}, 0x{mask:02X}, {num_values}, {writable}}},"
+        )
+    out.append("};")
+
+
+def main():
+    which = sys.argv[1] if len(sys.argv) > 1 else "log"
+    if which not in ("log", "config", "layouts"):
+        sys.exit("Usage: gen_field_tables.py [log|config|layouts]")
+    if which == "layouts":
+        emit_layouts()
+        return
+    module, classname, enum_name, prefix = LOG_STRUCT if which == "log" else CONFIG_STRUCT
+    accessors = load_accessors(module, classname)
+
+    # Share identical enum value lists between fields
+    value_names = {}
+    for tag, accessor in accessors:
+        if enum_values(tag, accessor):
+            key = tuple(enum_values(tag, accessor))
+            if key not in value_names:
+                value_names[key] = f"{prefix}_VALUES_{len(value_names)}"
+
+    out = [
+        f"// Generated by utils/gen_field_tables.py from utils/config/{module}.py - do not edit.",
+        "#pragma once",
+        "",
+        '#include "gecko_fields.h"',
+        "",
+        "namespace esphome {",
+        "namespace gecko_spa {",
+        "",
+        f"enum class {enum_name} : uint8_t {{",
+    ]
+    for tag, _ in accessors:
+        out.append(f"  {tag},")
+    out.append("  COUNT")
+    out.append("};")
+    out.append("")
+
+    for values, name in value_names.items():
+        quoted = ", ".join(f'"{v}"' for v in values)
+        out.append(f"static constexpr const char *{name}[] = {{{quoted}}};")
+    out.append("")
+
+    if which == "log":
+        out.append(f"// {module}: used for status versions > 50")
+        emit_table(out, f"{prefix}_FIELDS_V65", accessors, value_names)
+        out.append("")
+        out.append("// Status versions <= 50: only the fields with known positions")
+        emit_table(out, f"{prefix}_FIELDS_V50", accessors, value_names, LOG_V50_POSITIONS)
+        tables = ("V65", "V50")
+    else:
+        end = struct_end(accessors, CONFIG_POSITION_SHIFTS)
+        out.append("// Bytes of the config section covered by the fields")
+        out.append(f"static const uint16_t {prefix}_STRUCT_LEN = {end};")
+        out.append("")
+        out.append(f"// {module}: positions are message bytes from the start of the config section")
+        emit_table(out, f"{prefix}_FIELDS_V65", accessors, value_names, shifts=CONFIG_POSITION_SHIFTS,
+                   writable_end=CONFIG_WRITABLE_END)
+        tables = ("V65",)
+    out.append("")
+    for table in tables:
+        out.append(
+            f"static_assert(sizeof({prefix}_FIELDS_{table}) / sizeof(FieldDesc) == "
+            f'(size_t) {enum_name}::COUNT, "{prefix}_FIELDS_{table} size");'
+        )
+    out.append("")
+    out.append("}  // namespace gecko_spa")
+    out.append("}  // namespace esphome")
+    sys.stdout.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()